@@ -5,6 +5,7 @@
 #include <iostream>
 #include <algorithm>
 #include <functional>
+#include <type_traits>
 
 /**
  * Binary Search Algorithm Implementation
@@ -16,25 +17,53 @@
  * 
  * Binary search works on sorted arrays by repeatedly dividing the search
  * interval in half and comparing the target with the middle element.
+ * 
+ * Every search function also has an overload taking a probe policy as its
+ * last argument. The policy is told when a search begins, about every
+ * element it probes, when it first sees an equal key, and how it ended
+ * (see SearchStats in search_stats.h). The plain overloads pass NullProbe,
+ * whose empty inline hooks compile away entirely.
  */
 
 namespace BinarySearch {
     
+    /**
+     * Probe policy that records nothing (zero overhead)
+     */
+    struct NullProbe {
+        void begin() {}
+        void probe(size_t) {}
+        void hit() {}
+        void end(bool) {}
+    };
+    
+    /**
+     * True for probes that record something; lets callers skip work that
+     * only feeds the probe (such as an extra compare to compute "found")
+     */
+    template<typename Probe>
+    constexpr bool isRecordingProbe = !std::is_same_v<Probe, NullProbe>;
+    
     /**
      * Iterative Binary Search implementation
      * @param arr Sorted array to search in
      * @param target Value to search for
+     * @param probe Instrumentation policy
      * @return Index of target if found, -1 otherwise
      */
-    template<typename T>
-    int iterativeSearch(const std::vector<T>& arr, const T& target) {
+    template<typename T, typename Probe>
+    int iterativeSearch(const std::vector<T>& arr, const T& target, Probe& probe) {
         int left = 0;
         int right = arr.size() - 1;
+        probe.begin();
         
         while (left <= right) {
             int mid = left + (right - left) / 2;  // Avoid overflow
+            probe.probe(mid);
             
             if (arr[mid] == target) {
+                probe.hit();
+                probe.end(true);
                 return mid;
             } else if (arr[mid] < target) {
                 left = mid + 1;
@@ -43,44 +72,87 @@ namespace BinarySearch {
             }
         }
         
+        probe.end(false);
         return -1;  // Target not found
     }
     
     /**
-     * Recursive Binary Search implementation
-     * @param arr Sorted array to search in
-     * @param target Value to search for
-     * @param left Left boundary of search range
-     * @param right Right boundary of search range
-     * @return Index of target if found, -1 otherwise
+     * Iterative Binary Search without instrumentation
      */
     template<typename T>
-    int recursiveSearch(const std::vector<T>& arr, const T& target, int left, int right) {
+    int iterativeSearch(const std::vector<T>& arr, const T& target) {
+        NullProbe probe;
+        return iterativeSearch(arr, target, probe);
+    }
+    
+    /**
+     * One step of the recursive search over [left, right]
+     * Reports probes and the hit; the caller reports begin and end
+     */
+    template<typename T, typename Probe>
+    int recursiveSearchStep(const std::vector<T>& arr, const T& target, int left, int right, Probe& probe) {
         if (left > right) {
             return -1;  // Base case: target not found
         }
         
         int mid = left + (right - left) / 2;
+        probe.probe(mid);
         
         if (arr[mid] == target) {
+            probe.hit();
             return mid;
         } else if (arr[mid] < target) {
-            return recursiveSearch(arr, target, mid + 1, right);
+            return recursiveSearchStep(arr, target, mid + 1, right, probe);
         } else {
-            return recursiveSearch(arr, target, left, mid - 1);
+            return recursiveSearchStep(arr, target, left, mid - 1, probe);
         }
     }
     
+    /**
+     * Recursive Binary Search implementation
+     * @param arr Sorted array to search in
+     * @param target Value to search for
+     * @param left Left boundary of search range
+     * @param right Right boundary of search range
+     * @param probe Instrumentation policy
+     * @return Index of target if found, -1 otherwise
+     */
+    template<typename T, typename Probe>
+    int recursiveSearch(const std::vector<T>& arr, const T& target, int left, int right, Probe& probe) {
+        probe.begin();
+        int result = recursiveSearchStep(arr, target, left, right, probe);
+        probe.end(result != -1);
+        return result;
+    }
+    
+    /**
+     * Recursive Binary Search over [left, right] without instrumentation
+     */
+    template<typename T>
+    int recursiveSearch(const std::vector<T>& arr, const T& target, int left, int right) {
+        NullProbe probe;
+        return recursiveSearch(arr, target, left, right, probe);
+    }
+    
     /**
      * Public interface for recursive search
      * @param arr Sorted array to search in
      * @param target Value to search for
+     * @param probe Instrumentation policy
      * @return Index of target if found, -1 otherwise
      */
+    template<typename T, typename Probe>
+    int recursiveSearch(const std::vector<T>& arr, const T& target, Probe& probe) {
+        return recursiveSearch(arr, target, 0, static_cast<int>(arr.size()) - 1, probe);
+    }
+    
+    /**
+     * Public interface for recursive search without instrumentation
+     */
     template<typename T>
     int recursiveSearch(const std::vector<T>& arr, const T& target) {
-        if (arr.empty()) return -1;
-        return recursiveSearch(arr, target, 0, arr.size() - 1);
+        NullProbe probe;
+        return recursiveSearch(arr, target, probe);
     }
     
     /**
@@ -88,18 +160,22 @@ namespace BinarySearch {
      * Useful when array contains duplicates
      * @param arr Sorted array to search in
      * @param target Value to search for
+     * @param probe Instrumentation policy
      * @return Index of first occurrence, -1 if not found
      */
-    template<typename T>
-    int findFirst(const std::vector<T>& arr, const T& target) {
+    template<typename T, typename Probe>
+    int findFirst(const std::vector<T>& arr, const T& target, Probe& probe) {
         int left = 0;
         int right = arr.size() - 1;
         int result = -1;
+        probe.begin();
         
         while (left <= right) {
             int mid = left + (right - left) / 2;
+            probe.probe(mid);
             
             if (arr[mid] == target) {
+                if (result == -1) probe.hit();
                 result = mid;
                 right = mid - 1;  // Continue searching left half
             } else if (arr[mid] < target) {
@@ -109,26 +185,40 @@ namespace BinarySearch {
             }
         }
         
+        probe.end(result != -1);
         return result;
     }
     
+    /**
+     * First occurrence without instrumentation
+     */
+    template<typename T>
+    int findFirst(const std::vector<T>& arr, const T& target) {
+        NullProbe probe;
+        return findFirst(arr, target, probe);
+    }
+    
     /**
      * Find last occurrence of target (rightmost)
      * Useful when array contains duplicates
      * @param arr Sorted array to search in
      * @param target Value to search for
+     * @param probe Instrumentation policy
      * @return Index of last occurrence, -1 if not found
      */
-    template<typename T>
-    int findLast(const std::vector<T>& arr, const T& target) {
+    template<typename T, typename Probe>
+    int findLast(const std::vector<T>& arr, const T& target, Probe& probe) {
         int left = 0;
         int right = arr.size() - 1;
         int result = -1;
+        probe.begin();
         
         while (left <= right) {
             int mid = left + (right - left) / 2;
+            probe.probe(mid);
             
             if (arr[mid] == target) {
+                if (result == -1) probe.hit();
                 result = mid;
                 left = mid + 1;  // Continue searching right half
             } else if (arr[mid] < target) {
@@ -138,37 +228,60 @@ namespace BinarySearch {
             }
         }
         
+        probe.end(result != -1);
         return result;
     }
     
+    /**
+     * Last occurrence without instrumentation
+     */
+    template<typename T>
+    int findLast(const std::vector<T>& arr, const T& target) {
+        NullProbe probe;
+        return findLast(arr, target, probe);
+    }
+    
     /**
      * Count occurrences of target in sorted array
      * @param arr Sorted array to search in
      * @param target Value to count
+     * @param probe Instrumentation policy (sees both boundary searches)
      * @return Number of occurrences
      */
-    template<typename T>
-    int countOccurrences(const std::vector<T>& arr, const T& target) {
-        int first = findFirst(arr, target);
+    template<typename T, typename Probe>
+    int countOccurrences(const std::vector<T>& arr, const T& target, Probe& probe) {
+        int first = findFirst(arr, target, probe);
         if (first == -1) return 0;
         
-        int last = findLast(arr, target);
+        int last = findLast(arr, target, probe);
         return last - first + 1;
     }
     
+    /**
+     * Count occurrences without instrumentation
+     */
+    template<typename T>
+    int countOccurrences(const std::vector<T>& arr, const T& target) {
+        NullProbe probe;
+        return countOccurrences(arr, target, probe);
+    }
+    
     /**
      * Find insertion point for target to maintain sorted order
      * @param arr Sorted array
      * @param target Value to find insertion point for
+     * @param probe Instrumentation policy
      * @return Index where target should be inserted
      */
-    template<typename T>
-    int findInsertionPoint(const std::vector<T>& arr, const T& target) {
+    template<typename T, typename Probe>
+    int findInsertionPoint(const std::vector<T>& arr, const T& target, Probe& probe) {
         int left = 0;
         int right = arr.size();
+        probe.begin();
         
         while (left < right) {
             int mid = left + (right - left) / 2;
+            probe.probe(mid);
             
             if (arr[mid] < target) {
                 left = mid + 1;
@@ -177,24 +290,104 @@ namespace BinarySearch {
             }
         }
         
+        if constexpr (isRecordingProbe<Probe>) {
+            probe.end(left < static_cast<int>(arr.size()) && !(target < arr[left]));
+        }
         return left;
     }
     
+    /**
+     * Find insertion point without instrumentation
+     */
+    template<typename T>
+    int findInsertionPoint(const std::vector<T>& arr, const T& target) {
+        NullProbe probe;
+        return findInsertionPoint(arr, target, probe);
+    }
+    
+    /**
+     * Branchless lower bound (first element not less than target)
+     * The loop always runs ceil(log2 n) times and the only data-dependent
+     * step is a conditional move, so it does not suffer branch mispredictions
+     * @param data Pointer to sorted elements
+     * @param n Number of elements
+     * @param target Value to find lower bound for
+     * @param probe Instrumentation policy
+     * @return Index of first element >= target, n if none
+     */
+    template<typename T, typename Probe>
+    size_t branchlessLowerBound(const T* data, size_t n, const T& target, Probe& probe) {
+        probe.begin();
+        if (n == 0) {
+            probe.end(false);
+            return 0;
+        }
+        
+        const T* base = data;
+        size_t size = n;
+        
+        while (n > 1) {
+            size_t half = n / 2;
+            probe.probe((base - data) + half);
+            base = (base[half] < target) ? base + half : base;
+            n -= half;
+        }
+        
+        size_t result = (base - data) + (*base < target);
+        if constexpr (isRecordingProbe<Probe>) {
+            probe.end(result < size && !(target < data[result]));
+        }
+        return result;
+    }
+    
+    /**
+     * Branchless lower bound without instrumentation
+     */
+    template<typename T>
+    size_t branchlessLowerBound(const T* data, size_t n, const T& target) {
+        NullProbe probe;
+        return branchlessLowerBound(data, n, target, probe);
+    }
+    
+    /**
+     * Branchless lower bound over a vector
+     * @param arr Sorted array to search in
+     * @param target Value to find lower bound for
+     * @return Index of first element >= target, arr.size() if none
+     */
+    template<typename T>
+    size_t branchlessLowerBound(const std::vector<T>& arr, const T& target) {
+        return branchlessLowerBound(arr.data(), arr.size(), target);
+    }
+    
+    /**
+     * Branchless lower bound over a vector with instrumentation
+     */
+    template<typename T, typename Probe>
+    size_t branchlessLowerBound(const std::vector<T>& arr, const T& target, Probe& probe) {
+        return branchlessLowerBound(arr.data(), arr.size(), target, probe);
+    }
+    
     /**
      * Search in rotated sorted array
      * @param arr Rotated sorted array
      * @param target Value to search for
+     * @param probe Instrumentation policy
      * @return Index of target if found, -1 otherwise
      */
-    template<typename T>
-    int searchRotated(const std::vector<T>& arr, const T& target) {
+    template<typename T, typename Probe>
+    int searchRotated(const std::vector<T>& arr, const T& target, Probe& probe) {
         int left = 0;
         int right = arr.size() - 1;
+        probe.begin();
         
         while (left <= right) {
             int mid = left + (right - left) / 2;
+            probe.probe(mid);
             
             if (arr[mid] == target) {
+                probe.hit();
+                probe.end(true);
                 return mid;
             }
             
@@ -216,30 +409,47 @@ namespace BinarySearch {
             }
         }
         
+        probe.end(false);
         return -1;
     }
     
+    /**
+     * Search in rotated sorted array without instrumentation
+     */
+    template<typename T>
+    int searchRotated(const std::vector<T>& arr, const T& target) {
+        NullProbe probe;
+        return searchRotated(arr, target, probe);
+    }
+    
     /**
      * Find peak element in array (element greater than its neighbors)
      * @param arr Array to search in
+     * @param probe Instrumentation policy
      * @return Index of a peak element
      */
-    template<typename T>
-    int findPeak(const std::vector<T>& arr) {
-        if (arr.empty()) return -1;
-        if (arr.size() == 1) return 0;
+    template<typename T, typename Probe>
+    int findPeak(const std::vector<T>& arr, Probe& probe) {
+        probe.begin();
+        if (arr.size() <= 1) {
+            probe.end(!arr.empty());
+            return arr.empty() ? -1 : 0;
+        }
         
         int left = 0;
         int right = arr.size() - 1;
         
         while (left <= right) {
             int mid = left + (right - left) / 2;
+            probe.probe(mid);
             
             // Check if mid is a peak
             bool leftOk = (mid == 0) || (arr[mid] >= arr[mid - 1]);
             bool rightOk = (mid == static_cast<int>(arr.size()) - 1) || (arr[mid] >= arr[mid + 1]);
             
             if (leftOk && rightOk) {
+                probe.hit();
+                probe.end(true);
                 return mid;
             } else if (mid > 0 && arr[mid - 1] > arr[mid]) {
                 right = mid - 1;  // Peak is in left half
@@ -248,26 +458,41 @@ namespace BinarySearch {
             }
         }
         
+        probe.end(false);
         return -1;
     }
     
+    /**
+     * Find peak element without instrumentation
+     */
+    template<typename T>
+    int findPeak(const std::vector<T>& arr) {
+        NullProbe probe;
+        return findPeak(arr, probe);
+    }
+    
     /**
      * Binary search with custom comparator
      * @param arr Sorted array
      * @param target Value to search for
      * @param comp Custom comparator function
+     * @param probe Instrumentation policy
      * @return Index of target if found, -1 otherwise
      */
-    template<typename T, typename Compare>
-    int searchWithComparator(const std::vector<T>& arr, const T& target, Compare comp) {
+    template<typename T, typename Compare, typename Probe>
+    int searchWithComparator(const std::vector<T>& arr, const T& target, Compare comp, Probe& probe) {
         int left = 0;
         int right = arr.size() - 1;
+        probe.begin();
         
         while (left <= right) {
             int mid = left + (right - left) / 2;
+            probe.probe(mid);
             
             if (!comp(arr[mid], target) && !comp(target, arr[mid])) {
                 // arr[mid] == target according to comparator
+                probe.hit();
+                probe.end(true);
                 return mid;
             } else if (comp(arr[mid], target)) {
                 left = mid + 1;
@@ -276,19 +501,32 @@ namespace BinarySearch {
             }
         }
         
+        probe.end(false);
         return -1;
     }
     
+    /**
+     * Binary search with custom comparator without instrumentation
+     */
+    template<typename T, typename Compare>
+    int searchWithComparator(const std::vector<T>& arr, const T& target, Compare comp) {
+        NullProbe probe;
+        return searchWithComparator(arr, target, comp, probe);
+    }
+    
     /**
      * Search for target in 2D sorted matrix
      * Matrix is sorted row-wise and column-wise
      * @param matrix 2D sorted matrix
      * @param target Value to search for
+     * @param probe Instrumentation policy (probe index is the flattened position)
      * @return Pair of indices if found, {-1, -1} otherwise
      */
-    template<typename T>
-    std::pair<int, int> search2D(const std::vector<std::vector<T>>& matrix, const T& target) {
+    template<typename T, typename Probe>
+    std::pair<int, int> search2D(const std::vector<std::vector<T>>& matrix, const T& target, Probe& probe) {
+        probe.begin();
         if (matrix.empty() || matrix[0].empty()) {
+            probe.end(false);
             return {-1, -1};
         }
         
@@ -301,8 +539,11 @@ namespace BinarySearch {
             int mid = left + (right - left) / 2;
             int row = mid / cols;
             int col = mid % cols;
+            probe.probe(mid);
             
             if (matrix[row][col] == target) {
+                probe.hit();
+                probe.end(true);
                 return {row, col};
             } else if (matrix[row][col] < target) {
                 left = mid + 1;
@@ -311,9 +552,19 @@ namespace BinarySearch {
             }
         }
         
+        probe.end(false);
         return {-1, -1};
     }
     
+    /**
+     * Search 2D sorted matrix without instrumentation
+     */
+    template<typename T>
+    std::pair<int, int> search2D(const std::vector<std::vector<T>>& matrix, const T& target) {
+        NullProbe probe;
+        return search2D(matrix, target, probe);
+    }
+    
     /**
      * Public interface for standard binary search
      * @param arr Sorted array to search in
@@ -325,6 +576,14 @@ namespace BinarySearch {
         return iterativeSearch(arr, target);
     }
     
+    /**
+     * Standard binary search with instrumentation
+     */
+    template<typename T, typename Probe>
+    int search(const std::vector<T>& arr, const T& target, Probe& probe) {
+        return iterativeSearch(arr, target, probe);
+    }
+    
     /**
      * Utility function to verify if array is sorted
      * @param arr Array to check
@@ -0,0 +1,226 @@
+#ifndef BINARY_SEARCH_CACHE_H
+#define BINARY_SEARCH_CACHE_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include "binary_search.h"
+
+/**
+ * Hot-Key Cache in front of Binary Search
+ *
+ * Time Complexity:
+ * - Cache hit: O(1) - one set of tags is compared
+ * - Cache miss: O(log n) - falls back to BinarySearch::search
+ *
+ * Space Complexity: O(c) where c is the cache capacity
+ *
+ * Skewed (Zipfian) query streams repeat the same few keys over and over.
+ * This cache remembers recent key -> index results in a small set-associative
+ * table so the hot keys skip the full binary search descent. A set (tags,
+ * cached indices and CLOCK state for 7 ways) fills exactly one 64-byte cache
+ * line, so a lookup compares all ways with a single loop and a hit updates
+ * its reference bit in that same line. The full key, kept in a parallel
+ * array, is read only to confirm a tag match. A CLOCK hand picks the victim
+ * on a miss.
+ */
+
+namespace BinarySearch {
+
+    template<typename T, typename Hash = std::hash<T>>
+    class HotKeyCache {
+    public:
+        static constexpr size_t WAYS = 7;   // Largest count that fits one cache line
+
+    private:
+        /**
+         * One cache set: tags, cached indices and CLOCK state in one line
+         */
+        struct alignas(64) CacheSet {
+            uint32_t tags[WAYS];        // 0 marks an empty way
+            int32_t indices[WAYS];      // Cached search result (-1 = absent)
+            uint8_t referenced;         // CLOCK reference bits, one per way
+            uint8_t hand;               // CLOCK hand position
+        };
+        static_assert(sizeof(CacheSet) == 64, "A cache set must fill exactly one cache line");
+
+        const std::vector<T>* arr;      // Sorted array being searched
+        std::vector<CacheSet> sets;     // Tag/index storage
+        std::vector<T> keys;            // Full keys, to confirm tag matches
+        size_t setMask;                 // Number of sets - 1
+        Hash hasher;
+        size_t hits;
+        size_t misses;
+
+    public:
+        /**
+         * Constructor - Build an empty cache in front of a sorted array
+         * @param sorted Sorted array to search in (must outlive the cache)
+         * @param capacity Approximate number of cached keys (rounded up to WAYS times a power of two)
+         * @throws std::invalid_argument if capacity is zero
+         */
+        explicit HotKeyCache(const std::vector<T>& sorted, size_t capacity = 4096)
+            : arr(&sorted), setMask(0), hits(0), misses(0) {
+            if (capacity == 0) {
+                throw std::invalid_argument("Capacity must be positive");
+            }
+
+            size_t setCount = 1;
+            while (setCount * WAYS < capacity) {
+                setCount <<= 1;
+            }
+
+            sets.resize(setCount);
+            keys.resize(setCount * WAYS);
+            setMask = setCount - 1;
+            invalidate();
+        }
+
+        /**
+         * Search for target, serving repeated keys from the cache
+         * @param target Value to search for
+         * @return Index of target if found, -1 otherwise
+         */
+        int search(const T& target) {
+            uint64_t h = mix(hasher(target));
+            CacheSet& set = sets[h & setMask];
+            uint32_t tag = static_cast<uint32_t>(h >> 32) | 1u;
+
+            // Compare every way at once; the loop has no early exit so the
+            // compiler can turn it into a single vector compare
+            unsigned matches = 0;
+            for (size_t way = 0; way < WAYS; ++way) {
+                matches |= static_cast<unsigned>(set.tags[way] == tag) << way;
+            }
+
+            size_t base = (h & setMask) * WAYS;
+            while (matches != 0) {
+                size_t way = lowestBit(matches);
+                if (keys[base + way] == target) {
+                    set.referenced |= static_cast<uint8_t>(1u << way);
+                    hits++;
+                    return set.indices[way];
+                }
+                matches &= matches - 1;
+            }
+
+            misses++;
+            int result = BinarySearch::search(*arr, target);
+
+            size_t victim = chooseVictim(set);
+            set.tags[victim] = tag;
+            set.indices[victim] = result;
+            set.referenced |= static_cast<uint8_t>(1u << victim);
+            keys[base + victim] = target;
+            return result;
+        }
+
+        /**
+         * Point the cache at a rebuilt array and drop every cached result
+         * @param sorted New sorted array (must outlive the cache)
+         */
+        void rebuild(const std::vector<T>& sorted) {
+            arr = &sorted;
+            invalidate();
+        }
+
+        /**
+         * Drop every cached result (call whenever the array is modified)
+         */
+        void invalidate() {
+            for (auto& set : sets) {
+                for (size_t way = 0; way < WAYS; ++way) {
+                    set.tags[way] = 0;
+                    set.indices[way] = -1;
+                }
+                set.referenced = 0;
+                set.hand = 0;
+            }
+        }
+
+        /**
+         * Get number of lookups served from the cache
+         */
+        size_t getHits() const {
+            return hits;
+        }
+
+        /**
+         * Get number of lookups that fell through to binary search
+         */
+        size_t getMisses() const {
+            return misses;
+        }
+
+        /**
+         * Get fraction of lookups served from the cache
+         * @return Hit rate in [0, 1], 0 if no lookups were made
+         */
+        double hitRate() const {
+            size_t total = hits + misses;
+            return total == 0 ? 0.0 : static_cast<double>(hits) / total;
+        }
+
+        /**
+         * Reset hit/miss counters without touching cached entries
+         */
+        void resetStats() {
+            hits = 0;
+            misses = 0;
+        }
+
+        /**
+         * Get number of keys the cache can hold
+         */
+        size_t getCapacity() const {
+            return sets.size() * WAYS;
+        }
+
+    private:
+        /**
+         * Spread hash bits so both set index and tag are well distributed
+         */
+        static uint64_t mix(uint64_t h) {
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdULL;
+            h ^= h >> 33;
+            h *= 0xc4ceb9fe1a85ec53ULL;
+            h ^= h >> 33;
+            return h;
+        }
+
+        static size_t lowestBit(unsigned mask) {
+            size_t bit = 0;
+            while ((mask & 1u) == 0) {
+                mask >>= 1;
+                bit++;
+            }
+            return bit;
+        }
+
+        /**
+         * CLOCK replacement: clear reference bits until an unreferenced way is found
+         */
+        static size_t chooseVictim(CacheSet& set) {
+            for (size_t way = 0; way < WAYS; ++way) {
+                if (set.tags[way] == 0) {
+                    return way;
+                }
+            }
+
+            while (true) {
+                size_t way = set.hand;
+                set.hand = static_cast<uint8_t>((set.hand + 1) % WAYS);
+                uint8_t bit = static_cast<uint8_t>(1u << way);
+                if ((set.referenced & bit) == 0) {
+                    return way;
+                }
+                set.referenced &= static_cast<uint8_t>(~bit);
+            }
+        }
+    };
+}
+
+#endif // BINARY_SEARCH_CACHE_H
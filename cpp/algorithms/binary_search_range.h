@@ -0,0 +1,217 @@
+#ifndef BINARY_SEARCH_RANGE_H
+#define BINARY_SEARCH_RANGE_H
+
+#include <span>
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <type_traits>
+#include "binary_search.h"
+
+/**
+ * Range Queries over Sorted Storage (requires C++20 for std::span)
+ *
+ * Time Complexity:
+ * - Key range / prefix / equal range: O(log n) - two lower-bound descents
+ * - Batched range query: O(q log n)
+ *
+ * Space Complexity: O(1) per query - results are views, nothing is copied
+ *
+ * Instead of calling findInsertionPoint twice and slicing by hand, these
+ * functions return std::span views straight into the sorted storage. The
+ * span overloads work for any contiguous storage, so memory-mapped files
+ * can be queried in place through mappedSpan(). Mutable (std::span<T>) and
+ * fixed-extent spans are accepted as well and searched as std::span<const T>.
+ */
+
+namespace BinarySearch {
+
+    /**
+     * Branchless upper bound (first element greater than target)
+     * @param data Pointer to sorted elements
+     * @param n Number of elements
+     * @param target Value to find upper bound for
+     * @return Index of first element > target, n if none
+     */
+    template<typename T>
+    size_t branchlessUpperBound(const T* data, size_t n, const T& target) {
+        if (n == 0) return 0;
+
+        const T* base = data;
+
+        while (n > 1) {
+            size_t half = n / 2;
+            base = (target < base[half]) ? base : base + half;
+            n -= half;
+        }
+
+        return (base - data) + !(target < *base);
+    }
+
+    /**
+     * View of all keys in [lo, hi)
+     * @param sorted Sorted storage to search in
+     * @param lo Inclusive lower key
+     * @param hi Exclusive upper key
+     * @return Span of matching elements (empty if lo >= hi or none match)
+     */
+    template<typename T>
+    std::span<const T> rangeSpan(std::span<const T> sorted, const T& lo, const T& hi) {
+        size_t first = branchlessLowerBound(sorted.data(), sorted.size(), lo);
+        size_t last = branchlessLowerBound(sorted.data(), sorted.size(), hi);
+        if (last < first) last = first;
+        return sorted.subspan(first, last - first);
+    }
+
+    /**
+     * View of all keys in [lo, hi) of a vector
+     */
+    template<typename T>
+    std::span<const T> rangeSpan(const std::vector<T>& sorted, const T& lo, const T& hi) {
+        return rangeSpan(std::span<const T>(sorted), lo, hi);
+    }
+
+    /**
+     * View of all keys in [lo, hi) of a mutable or fixed-extent span
+     */
+    template<typename T, size_t Extent>
+        requires (!std::is_const_v<T> || Extent != std::dynamic_extent)
+    std::span<const T> rangeSpan(std::span<T, Extent> sorted, const std::type_identity_t<T>& lo,
+                                 const std::type_identity_t<T>& hi) {
+        return rangeSpan(std::span<const std::remove_const_t<T>>(sorted), lo, hi);
+    }
+
+    /**
+     * View of all keys less than hi (prefix range)
+     * @param sorted Sorted storage to search in
+     * @param hi Exclusive upper key
+     * @return Span from the start of storage up to hi
+     */
+    template<typename T>
+    std::span<const T> prefixSpan(std::span<const T> sorted, const T& hi) {
+        return sorted.first(branchlessLowerBound(sorted.data(), sorted.size(), hi));
+    }
+
+    /**
+     * View of all keys less than hi of a vector
+     */
+    template<typename T>
+    std::span<const T> prefixSpan(const std::vector<T>& sorted, const T& hi) {
+        return prefixSpan(std::span<const T>(sorted), hi);
+    }
+
+    /**
+     * View of all keys less than hi of a mutable or fixed-extent span
+     */
+    template<typename T, size_t Extent>
+        requires (!std::is_const_v<T> || Extent != std::dynamic_extent)
+    std::span<const T> prefixSpan(std::span<T, Extent> sorted, const std::type_identity_t<T>& hi) {
+        return prefixSpan(std::span<const std::remove_const_t<T>>(sorted), hi);
+    }
+
+    /**
+     * View of all keys equal to target (all duplicates)
+     * @param sorted Sorted storage to search in
+     * @param target Value to look for
+     * @return Span of equal elements, empty if target is absent
+     */
+    template<typename T>
+    std::span<const T> equalSpan(std::span<const T> sorted, const T& target) {
+        size_t first = branchlessLowerBound(sorted.data(), sorted.size(), target);
+        size_t last = branchlessUpperBound(sorted.data(), sorted.size(), target);
+        return sorted.subspan(first, last - first);
+    }
+
+    /**
+     * View of all keys equal to target of a vector
+     */
+    template<typename T>
+    std::span<const T> equalSpan(const std::vector<T>& sorted, const T& target) {
+        return equalSpan(std::span<const T>(sorted), target);
+    }
+
+    /**
+     * View of all keys equal to target of a mutable or fixed-extent span
+     */
+    template<typename T, size_t Extent>
+        requires (!std::is_const_v<T> || Extent != std::dynamic_extent)
+    std::span<const T> equalSpan(std::span<T, Extent> sorted, const std::type_identity_t<T>& target) {
+        return equalSpan(std::span<const std::remove_const_t<T>>(sorted), target);
+    }
+
+    /**
+     * Answer many [lo, hi) range queries at once
+     * @param sorted Sorted storage to search in
+     * @param ranges Pairs of (inclusive lo, exclusive hi) keys
+     * @return One span per range, in the same order
+     */
+    template<typename T>
+    std::vector<std::span<const T>> rangeBatch(std::span<const T> sorted,
+                                               const std::vector<std::pair<T, T>>& ranges) {
+        std::vector<std::span<const T>> results;
+        results.reserve(ranges.size());
+
+        for (const auto& [lo, hi] : ranges) {
+            results.push_back(rangeSpan(sorted, lo, hi));
+        }
+
+        return results;
+    }
+
+    /**
+     * Answer many [lo, hi) range queries at once over a vector
+     */
+    template<typename T>
+    std::vector<std::span<const T>> rangeBatch(const std::vector<T>& sorted,
+                                               const std::vector<std::pair<T, T>>& ranges) {
+        return rangeBatch(std::span<const T>(sorted), ranges);
+    }
+
+    /**
+     * Answer many [lo, hi) range queries at once over a mutable or fixed-extent span
+     */
+    template<typename T, size_t Extent>
+        requires (!std::is_const_v<T> || Extent != std::dynamic_extent)
+    std::vector<std::span<const T>> rangeBatch(
+        std::span<T, Extent> sorted,
+        const std::vector<std::pair<std::remove_const_t<T>, std::remove_const_t<T>>>& ranges) {
+        return rangeBatch(std::span<const std::remove_const_t<T>>(sorted), ranges);
+    }
+
+    /**
+     * Reinterpret a memory-mapped region holding sorted T records as a span
+     * The region must be suitably aligned for T and stay mapped while in use
+     * @param mapped Start of the mapped region
+     * @param bytes Length of the region in bytes (trailing partial records are ignored)
+     * @return Span over the records
+     */
+    template<typename T>
+    std::span<const T> mappedSpan(const void* mapped, size_t bytes) {
+        return std::span<const T>(static_cast<const T*>(mapped), bytes / sizeof(T));
+    }
+
+    /**
+     * Convert a span returned by a range query back into an index range
+     * @param sorted Storage the span was taken from
+     * @param view Span returned by a range query
+     * @return Pair of (first index, one-past-last index)
+     */
+    template<typename T>
+    std::pair<size_t, size_t> spanToIndices(std::span<const T> sorted, std::span<const T> view) {
+        size_t first = view.data() - sorted.data();
+        return {first, first + view.size()};
+    }
+
+    /**
+     * Convert a span returned by a range query back into an index range of
+     * a mutable or fixed-extent span
+     */
+    template<typename T, size_t Extent>
+        requires (!std::is_const_v<T> || Extent != std::dynamic_extent)
+    std::pair<size_t, size_t> spanToIndices(std::span<T, Extent> sorted,
+                                            std::span<const std::remove_const_t<T>> view) {
+        return spanToIndices(std::span<const std::remove_const_t<T>>(sorted), view);
+    }
+}
+
+#endif // BINARY_SEARCH_RANGE_H
@@ -0,0 +1,142 @@
+#ifndef CONCURRENT_INDEX_H
+#define CONCURRENT_INDEX_H
+
+#include <atomic>
+#include <vector>
+#include <mutex>
+#include <utility>
+#include "binary_search.h"
+#include "../data_structures/epoch_manager.h"
+
+/**
+ * Concurrent Sorted Index with Lock-Free Reads
+ *
+ * Time Complexity:
+ * - Search: O(log n), wait-free (never blocks, never takes a lock)
+ * - Publish: O(n) to build the new version, O(1) to swap it in
+ *
+ * Space Complexity: O(n) per live version; old versions are freed once no
+ * reader can still see them
+ *
+ * The sorted array is immutable once published. A writer builds a new
+ * array and swaps the pointer atomically. Readers pin an epoch, load the
+ * pointer and search, so they never wait on the writer or on each other.
+ * The replaced array is retired through an EpochManager and freed after
+ * every reader that might still hold it has moved on. Each version is a
+ * full copy of the index, so publish collects right away instead of waiting
+ * for the manager's batch threshold. Only versions that a pinned reader
+ * may still see stay alive.
+ */
+
+namespace BinarySearch {
+
+    template<typename T>
+    class ConcurrentIndex {
+    private:
+        std::atomic<const std::vector<T>*> current;   // Published version
+        EpochManager epochs;                          // Reclaims replaced versions
+        std::mutex writerMutex;                       // Serializes publishers only
+
+    public:
+        /**
+         * Consistent view of one published version
+         * Valid until destroyed; keep it short-lived so old versions can be freed
+         */
+        class Snapshot {
+        private:
+            EpochManager::Guard guard;
+            const std::vector<T>* data;
+
+        public:
+            Snapshot(EpochManager::Guard g, const std::vector<T>* d) : guard(std::move(g)), data(d) {}
+
+            const std::vector<T>& get() const {
+                return *data;
+            }
+
+            int search(const T& target) const {
+                return BinarySearch::search(*data, target);
+            }
+        };
+
+        /**
+         * Per-thread reader; create one per reader thread and reuse it
+         */
+        class ReadHandle {
+        private:
+            ConcurrentIndex* index;
+            EpochManager::Handle handle;
+
+        public:
+            ReadHandle(ConcurrentIndex* idx, EpochManager::Handle h) : index(idx), handle(std::move(h)) {}
+
+            /**
+             * Pin the current version for several lookups
+             */
+            Snapshot snapshot() {
+                EpochManager::Guard guard = handle.pin();
+                const std::vector<T>* data = index->current.load(std::memory_order_seq_cst);
+                return Snapshot(std::move(guard), data);
+            }
+
+            /**
+             * Search the current version
+             * @return Index of target if found, -1 otherwise
+             */
+            int search(const T& target) {
+                return snapshot().search(target);
+            }
+        };
+
+        /**
+         * Constructor - Publish an initial sorted array
+         * @param sorted Initial contents (must be sorted)
+         */
+        explicit ConcurrentIndex(std::vector<T> sorted = {})
+            : current(new std::vector<T>(std::move(sorted))) {}
+
+        ConcurrentIndex(const ConcurrentIndex&) = delete;
+        ConcurrentIndex& operator=(const ConcurrentIndex&) = delete;
+
+        /**
+         * Destructor - No reader may be using the index any more
+         */
+        ~ConcurrentIndex() {
+            delete current.load();
+        }
+
+        /**
+         * Atomically replace the index with a new sorted array
+         * Readers in flight keep using the old version until they finish
+         * @param sorted New contents (must be sorted)
+         */
+        void publish(std::vector<T> sorted) {
+            auto* next = new std::vector<T>(std::move(sorted));
+
+            std::lock_guard<std::mutex> lock(writerMutex);
+            const std::vector<T>* old = current.exchange(next, std::memory_order_seq_cst);
+            EpochManager::Handle& handle = epochs.local();
+            handle.retire(const_cast<std::vector<T>*>(old));
+            handle.collect();
+        }
+
+        /**
+         * Create a reader for the calling thread
+         * @throws std::runtime_error if too many readers are registered
+         */
+        ReadHandle reader() {
+            return ReadHandle(this, epochs.registerThread());
+        }
+
+        /**
+         * Search using the calling thread's implicit handle
+         * @return Index of target if found, -1 otherwise
+         */
+        int search(const T& target) {
+            EpochManager::Guard guard = epochs.local().pin();
+            return BinarySearch::search(*current.load(std::memory_order_seq_cst), target);
+        }
+    };
+}
+
+#endif // CONCURRENT_INDEX_H
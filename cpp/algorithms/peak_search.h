@@ -0,0 +1,362 @@
+#ifndef PEAK_SEARCH_H
+#define PEAK_SEARCH_H
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+
+/**
+ * Peak and Extremum Search
+ *
+ * Time Complexity:
+ * - findPeak / findValley on a lazy sequence: O(log n) evaluations
+ * - unimodalMax / unimodalMin (integer domain): O(log n) evaluations
+ * - ternarySearchMax / ternarySearchMin (real domain): O(iterations) evaluations
+ * - findAllPeaks / findAllValleys: O(n), branch-free inner loop
+ * - StreamingPeakDetector: O(1) per sample
+ *
+ * Space Complexity: O(1), plus O(k) for memoized values or reported indices
+ *
+ * BinarySearch::findPeak needs a materialized vector. These functions take
+ * any callable index -> value, so expensive samples are only computed at the
+ * O(log n) positions the search actually probes. LazySequence adds
+ * memoization on top. For data that is already in memory, findAllPeaks
+ * reports every local maximum using a comparison pass the compiler can
+ * vectorize.
+ */
+
+namespace PeakSearch {
+
+    /**
+     * Lazily evaluated sequence that memoizes every computed element
+     */
+    template<typename T, typename F>
+    class LazySequence {
+    private:
+        F generator;                                  // index -> value
+        size_t length;                                // Number of elements
+        mutable std::unordered_map<size_t, T> memo;   // Already computed values
+        mutable size_t evaluations;                   // Calls made to generator
+
+    public:
+        /**
+         * Constructor
+         * @param gen Callable mapping an index in [0, n) to its value
+         * @param n Length of the sequence
+         */
+        LazySequence(F gen, size_t n) : generator(std::move(gen)), length(n), evaluations(0) {}
+
+        /**
+         * Get element at index, computing it on first access
+         * @throws std::out_of_range if index is invalid
+         */
+        const T& operator()(size_t index) const {
+            if (index >= length) {
+                throw std::out_of_range("Index out of range");
+            }
+
+            auto it = memo.find(index);
+            if (it == memo.end()) {
+                evaluations++;
+                it = memo.emplace(index, generator(index)).first;
+            }
+            return it->second;
+        }
+
+        size_t size() const {
+            return length;
+        }
+
+        /**
+         * Get number of times the generator was actually called
+         */
+        size_t getEvaluations() const {
+            return evaluations;
+        }
+
+        /**
+         * Forget memoized values (e.g. after the underlying data changed)
+         */
+        void clearMemo() {
+            memo.clear();
+        }
+    };
+
+    /**
+     * Helper to deduce LazySequence template arguments from a callable
+     */
+    template<typename F>
+    auto makeLazySequence(F gen, size_t n) {
+        using T = std::decay_t<decltype(gen(size_t{0}))>;
+        return LazySequence<T, F>(std::move(gen), n);
+    }
+
+    /**
+     * Find a local maximum of a lazily evaluated sequence
+     * @param at Callable index -> value
+     * @param n Length of the sequence
+     * @return Index of a local maximum, -1 if n == 0
+     */
+    template<typename F>
+    long long findPeak(const F& at, size_t n) {
+        if (n == 0) return -1;
+
+        size_t left = 0;
+        size_t right = n - 1;
+
+        // Walk uphill: if the next element is larger a peak lies to the right
+        while (left < right) {
+            size_t mid = left + (right - left) / 2;
+            if (at(mid) < at(mid + 1)) {
+                left = mid + 1;
+            } else {
+                right = mid;
+            }
+        }
+
+        return static_cast<long long>(left);
+    }
+
+    /**
+     * Find a local minimum of a lazily evaluated sequence
+     * @param at Callable index -> value
+     * @param n Length of the sequence
+     * @return Index of a local minimum, -1 if n == 0
+     */
+    template<typename F>
+    long long findValley(const F& at, size_t n) {
+        if (n == 0) return -1;
+
+        size_t left = 0;
+        size_t right = n - 1;
+
+        while (left < right) {
+            size_t mid = left + (right - left) / 2;
+            if (at(mid + 1) < at(mid)) {
+                left = mid + 1;
+            } else {
+                right = mid;
+            }
+        }
+
+        return static_cast<long long>(left);
+    }
+
+    /**
+     * Maximum of a unimodal function over integers [lo, hi]
+     * Bisection on the sign of f(mid + 1) - f(mid) needs only two
+     * evaluations per halving, fewer than ternary search's two per third
+     * @param f Callable long long -> value, strictly increasing then decreasing
+     * @return Argument of the maximum
+     * @throws std::invalid_argument if lo > hi
+     */
+    template<typename F>
+    long long unimodalMax(const F& f, long long lo, long long hi) {
+        if (lo > hi) {
+            throw std::invalid_argument("Empty search interval");
+        }
+
+        while (lo < hi) {
+            long long mid = lo + (hi - lo) / 2;
+            if (f(mid) < f(mid + 1)) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return lo;
+    }
+
+    /**
+     * Minimum of a unimodal function over integers [lo, hi]
+     * @param f Callable long long -> value, strictly decreasing then increasing
+     * @return Argument of the minimum
+     * @throws std::invalid_argument if lo > hi
+     */
+    template<typename F>
+    long long unimodalMin(const F& f, long long lo, long long hi) {
+        if (lo > hi) {
+            throw std::invalid_argument("Empty search interval");
+        }
+
+        while (lo < hi) {
+            long long mid = lo + (hi - lo) / 2;
+            if (f(mid + 1) < f(mid)) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return lo;
+    }
+
+    /**
+     * Ternary search for the maximum of a unimodal function over reals
+     * @param f Callable double -> value
+     * @param lo Left end of the interval
+     * @param hi Right end of the interval
+     * @param iterations Number of narrowing steps (each keeps 2/3 of the interval)
+     * @return Approximate argument of the maximum
+     */
+    template<typename F>
+    double ternarySearchMax(const F& f, double lo, double hi, int iterations = 100) {
+        for (int i = 0; i < iterations; ++i) {
+            double m1 = lo + (hi - lo) / 3;
+            double m2 = hi - (hi - lo) / 3;
+            if (f(m1) < f(m2)) {
+                lo = m1;
+            } else {
+                hi = m2;
+            }
+        }
+        return lo + (hi - lo) / 2;
+    }
+
+    /**
+     * Ternary search for the minimum of a unimodal function over reals
+     */
+    template<typename F>
+    double ternarySearchMin(const F& f, double lo, double hi, int iterations = 100) {
+        for (int i = 0; i < iterations; ++i) {
+            double m1 = lo + (hi - lo) / 3;
+            double m2 = hi - (hi - lo) / 3;
+            if (f(m2) < f(m1)) {
+                lo = m1;
+            } else {
+                hi = m2;
+            }
+        }
+        return lo + (hi - lo) / 2;
+    }
+
+    /**
+     * Find every interior element that outranks both neighbours
+     * @param buf Samples to scan
+     * @param outranks outranks(a, b) is true if a is strictly more extreme than b
+     * @return Indices in increasing order; the first and last elements are never reported
+     */
+    template<typename T, typename Compare>
+    std::vector<size_t> findAllExtrema(const std::vector<T>& buf, Compare outranks) {
+        std::vector<size_t> extrema;
+        if (buf.size() < 3) return extrema;
+
+        const size_t BLOCK = 256;
+        uint8_t flags[BLOCK];
+
+        for (size_t start = 1; start + 1 < buf.size(); start += BLOCK) {
+            size_t count = std::min(BLOCK, buf.size() - 1 - start);
+
+            // Branch-free comparison pass: vectorizes into packed compares
+            for (size_t i = 0; i < count; ++i) {
+                const T& prev = buf[start + i - 1];
+                const T& cur = buf[start + i];
+                const T& next = buf[start + i + 1];
+                flags[i] = static_cast<uint8_t>(outranks(cur, prev) & outranks(cur, next));
+            }
+
+            for (size_t i = 0; i < count; ++i) {
+                if (flags[i]) extrema.push_back(start + i);
+            }
+        }
+
+        return extrema;
+    }
+
+    /**
+     * Find every strict local maximum in a buffer
+     * An interior element is a peak if it is greater than both neighbours;
+     * the first and last elements are never reported
+     * @param buf Samples to scan
+     * @return Indices of all peaks in increasing order
+     */
+    template<typename T>
+    std::vector<size_t> findAllPeaks(const std::vector<T>& buf) {
+        return findAllExtrema(buf, [](const T& a, const T& b) { return b < a; });
+    }
+
+    /**
+     * Find every strict local minimum in a buffer
+     * @param buf Samples to scan
+     * @return Indices of all valleys in increasing order
+     */
+    template<typename T>
+    std::vector<size_t> findAllValleys(const std::vector<T>& buf) {
+        return findAllExtrema(buf, [](const T& a, const T& b) { return a < b; });
+    }
+
+    /**
+     * Incremental peak detection over an unbounded sample stream
+     * A sample is confirmed as a peak once the following sample arrives
+     */
+    template<typename T>
+    class StreamingPeakDetector {
+    private:
+        T prev;          // Sample before cur
+        T cur;           // Most recent sample
+        size_t seen;     // Number of samples pushed so far
+
+    public:
+        StreamingPeakDetector() : prev(), cur(), seen(0) {}
+
+        /**
+         * Feed one sample
+         * @param value New sample
+         * @return Stream index of the peak confirmed by this sample, -1 if none
+         */
+        long long push(const T& value) {
+            long long result = -1;
+            if (seen >= 2 && prev < cur && value < cur) {
+                result = static_cast<long long>(seen - 1);
+            }
+            prev = cur;
+            cur = value;
+            seen++;
+            return result;
+        }
+
+        /**
+         * Feed a block of samples
+         * @param block New samples, in stream order
+         * @return Stream indices of all peaks confirmed by this block
+         */
+        std::vector<size_t> pushBatch(const std::vector<T>& block) {
+            std::vector<size_t> peaks;
+            if (block.empty()) return peaks;
+
+            // Prepend the carried-over samples so peaks spanning the block
+            // boundary are found by the same vectorized scan
+            size_t carried = std::min<size_t>(seen, 2);
+            std::vector<T> window;
+            window.reserve(block.size() + carried);
+            if (carried == 2) window.push_back(prev);
+            if (carried >= 1) window.push_back(cur);
+            window.insert(window.end(), block.begin(), block.end());
+
+            size_t windowStart = seen - carried;
+            for (size_t index : findAllPeaks(window)) {
+                peaks.push_back(windowStart + index);
+            }
+
+            if (window.size() >= 2) {
+                prev = window[window.size() - 2];
+            }
+            cur = window.back();
+            seen += block.size();
+            return peaks;
+        }
+
+        /**
+         * Get number of samples pushed so far
+         */
+        size_t getCount() const {
+            return seen;
+        }
+    };
+}
+
+#endif // PEAK_SEARCH_H
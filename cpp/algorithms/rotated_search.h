@@ -0,0 +1,193 @@
+#ifndef ROTATED_SEARCH_H
+#define ROTATED_SEARCH_H
+
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+#include "binary_search.h"
+
+/**
+ * Rotated Sorted Array Index
+ *
+ * Time Complexity:
+ * - Build / refresh rotation point: O(log n) (O(n) worst case with many duplicates)
+ * - Advance rotation on wrap: O(1)
+ * - Search: O(log n) with no data-dependent branches
+ * - Batched search: O(q log n), interleaved for memory-level parallelism
+ *
+ * Space Complexity: O(1) beyond the array being indexed
+ *
+ * BinarySearch::searchRotated works out which half is sorted on every call.
+ * For circular buffers the rotation point only moves when the buffer wraps,
+ * so this view finds it once and then maps every query onto a branchless
+ * lower bound over logical positions, translating logical -> physical
+ * indices with a modular offset.
+ */
+
+namespace BinarySearch {
+
+    template<typename T>
+    class RotatedIndex {
+    private:
+        static constexpr size_t BATCH_WIDTH = 8;  // Queries stepped together
+
+        const std::vector<T>* arr;  // Rotated sorted array being indexed
+        size_t offset;              // Physical index of the smallest element
+
+    public:
+        /**
+         * Constructor - Locate the rotation point of a rotated sorted array
+         * @param rotated Rotated sorted array (must outlive the index)
+         */
+        explicit RotatedIndex(const std::vector<T>& rotated) : arr(&rotated), offset(0) {
+            refresh();
+        }
+
+        /**
+         * Recompute the rotation point from scratch
+         * Call after arbitrary changes to the underlying array
+         */
+        void refresh() {
+            offset = findRotation(*arr);
+        }
+
+        /**
+         * Move the rotation point forward after a circular buffer wraps
+         * @param steps Number of oldest slots that were overwritten with new maxima
+         */
+        void advance(size_t steps = 1) {
+            if (arr->empty()) return;
+            offset = (offset + steps) % arr->size();
+        }
+
+        /**
+         * Get the physical index of the smallest element
+         */
+        size_t getRotation() const {
+            return offset;
+        }
+
+        /**
+         * Translate a logical (sorted-order) position into a physical index
+         * @param logical Position in sorted order
+         * @return Index into the underlying array
+         */
+        size_t toPhysical(size_t logical) const {
+            size_t physical = logical + offset;
+            return physical >= arr->size() ? physical - arr->size() : physical;
+        }
+
+        /**
+         * Element at a logical (sorted-order) position
+         */
+        const T& operator[](size_t logical) const {
+            return (*arr)[toPhysical(logical)];
+        }
+
+        /**
+         * Logical lower bound (first position whose element is not less than target)
+         * @param target Value to find lower bound for
+         * @return Logical position, size() if every element is smaller
+         */
+        size_t lowerBound(const T& target) const {
+            size_t n = arr->size();
+            if (n == 0) return 0;
+
+            size_t base = 0;
+            while (n > 1) {
+                size_t half = n / 2;
+                base = ((*this)[base + half] < target) ? base + half : base;
+                n -= half;
+            }
+
+            return base + ((*this)[base] < target);
+        }
+
+        /**
+         * Search for target
+         * @param target Value to search for
+         * @return Physical index of target if found, -1 otherwise
+         */
+        int search(const T& target) const {
+            size_t pos = lowerBound(target);
+            if (pos < arr->size() && (*this)[pos] == target) {
+                return static_cast<int>(toPhysical(pos));
+            }
+            return -1;
+        }
+
+        /**
+         * Search for many targets at once
+         * Queries are stepped through the descent in lockstep groups so the
+         * loads of independent queries overlap instead of stalling one by one
+         * @param targets Values to search for
+         * @return Physical index (or -1) for each target, in the same order
+         */
+        std::vector<int> searchBatch(const std::vector<T>& targets) const {
+            std::vector<int> results(targets.size(), -1);
+            size_t size = arr->size();
+            if (size == 0) return results;
+
+            for (size_t start = 0; start < targets.size(); start += BATCH_WIDTH) {
+                size_t count = std::min(BATCH_WIDTH, targets.size() - start);
+                size_t base[BATCH_WIDTH] = {};
+
+                size_t n = size;
+                while (n > 1) {
+                    size_t half = n / 2;
+                    for (size_t q = 0; q < count; ++q) {
+                        base[q] = ((*this)[base[q] + half] < targets[start + q]) ? base[q] + half : base[q];
+                    }
+                    n -= half;
+                }
+
+                for (size_t q = 0; q < count; ++q) {
+                    const T& target = targets[start + q];
+                    size_t pos = base[q] + ((*this)[base[q]] < target);
+                    if (pos < size && (*this)[pos] == target) {
+                        results[start + q] = static_cast<int>(toPhysical(pos));
+                    }
+                }
+            }
+
+            return results;
+        }
+
+        /**
+         * Get number of elements in the indexed array
+         */
+        size_t size() const {
+            return arr->size();
+        }
+
+        /**
+         * Find the physical index of the smallest element of a rotated sorted array
+         * @param rotated Rotated sorted array
+         * @return Rotation offset, 0 if the array is not rotated or empty
+         */
+        static size_t findRotation(const std::vector<T>& rotated) {
+            if (rotated.empty()) return 0;
+
+            size_t left = 0;
+            size_t right = rotated.size() - 1;
+
+            while (left < right) {
+                size_t mid = left + (right - left) / 2;
+
+                if (rotated[right] < rotated[mid]) {
+                    left = mid + 1;   // Drop is right of mid
+                } else if (rotated[mid] < rotated[right]) {
+                    right = mid;      // Mid is already past the drop
+                } else if (right > 0 && rotated[right] < rotated[right - 1]) {
+                    return right;     // Duplicates: right itself is the drop
+                } else {
+                    right--;          // Duplicates: cannot tell, shrink
+                }
+            }
+
+            return left;
+        }
+    };
+}
+
+#endif // ROTATED_SEARCH_H
@@ -0,0 +1,234 @@
+#ifndef SEARCH_STATS_H
+#define SEARCH_STATS_H
+
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+#include <iostream>
+#include <algorithm>
+
+/**
+ * Search Instrumentation Policy
+ *
+ * Time Complexity: O(1) per hook
+ * Space Complexity: O(H + S) for H histogram buckets and S latency samples
+ *
+ * Pass a SearchStats object as the probe argument of any BinarySearch
+ * function to record, per call:
+ * - number of probes,
+ * - depth of the first hit (probe count when an equal key was first seen),
+ * - equal-range depth (probes made after the first hit, e.g. by findFirst),
+ * - found / not-found outcome,
+ * - a sampled wall-clock latency.
+ *
+ * Define DSA_DISABLE_SEARCH_STATS to compile every hook to nothing; the
+ * plain overloads (NullProbe) never pay for instrumentation either way.
+ *
+ *     BinarySearch::SearchStats stats;
+ *     BinarySearch::search(arr, key, stats);
+ *     stats.exportHistograms(std::cout);
+ */
+
+namespace BinarySearch {
+
+    class SearchStats {
+    public:
+#ifdef DSA_DISABLE_SEARCH_STATS
+        static constexpr bool ENABLED = false;
+#else
+        static constexpr bool ENABLED = true;
+#endif
+        static constexpr size_t MAX_DEPTH = 64;   // Histogram buckets (deeper calls clamp)
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        // Totals
+        size_t calls;
+        size_t found;
+        size_t totalProbes;
+
+        // State of the call in progress
+        size_t probes;
+        size_t firstHitDepth;   // 0 = no hit yet
+        bool timing;
+        Clock::time_point started;
+
+        // Histograms indexed by depth
+        std::vector<size_t> probeHistogram;
+        std::vector<size_t> firstHitHistogram;
+        std::vector<size_t> equalRangeHistogram;
+
+        // Latency sampling
+        size_t sampleEvery;
+        size_t maxSamples;
+        std::vector<uint64_t> latencySamples;   // Nanoseconds
+
+    public:
+        /**
+         * Constructor
+         * @param sampleInterval Time every n-th call (0 disables latency sampling)
+         * @param sampleCapacity Maximum number of latency samples kept
+         */
+        explicit SearchStats(size_t sampleInterval = 64, size_t sampleCapacity = 4096)
+            : calls(0), found(0), totalProbes(0), probes(0), firstHitDepth(0), timing(false),
+              probeHistogram(MAX_DEPTH + 1, 0), firstHitHistogram(MAX_DEPTH + 1, 0),
+              equalRangeHistogram(MAX_DEPTH + 1, 0),
+              sampleEvery(sampleInterval), maxSamples(sampleCapacity) {}
+
+        // Probe policy hooks (called by BinarySearch functions)
+
+        void begin() {
+            if constexpr (ENABLED) {
+                probes = 0;
+                firstHitDepth = 0;
+                timing = sampleEvery != 0 && calls % sampleEvery == 0 && latencySamples.size() < maxSamples;
+                if (timing) started = Clock::now();
+            }
+        }
+
+        void probe(size_t) {
+            if constexpr (ENABLED) {
+                probes++;
+            }
+        }
+
+        void hit() {
+            if constexpr (ENABLED) {
+                if (firstHitDepth == 0) firstHitDepth = probes;
+            }
+        }
+
+        void end(bool wasFound) {
+            if constexpr (ENABLED) {
+                if (timing) {
+                    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - started);
+                    latencySamples.push_back(static_cast<uint64_t>(elapsed.count()));
+                }
+
+                calls++;
+                totalProbes += probes;
+                probeHistogram[std::min(probes, MAX_DEPTH)]++;
+                if (wasFound) found++;
+                if (firstHitDepth != 0) {
+                    firstHitHistogram[std::min(firstHitDepth, MAX_DEPTH)]++;
+                    equalRangeHistogram[std::min(probes - firstHitDepth, MAX_DEPTH)]++;
+                }
+            }
+        }
+
+        // Results
+
+        size_t getCalls() const {
+            return calls;
+        }
+
+        size_t getFound() const {
+            return found;
+        }
+
+        size_t getNotFound() const {
+            return calls - found;
+        }
+
+        /**
+         * Fraction of calls that found their target
+         * @return Ratio in [0, 1], 0 if no calls were recorded
+         */
+        double foundRatio() const {
+            return calls == 0 ? 0.0 : static_cast<double>(found) / calls;
+        }
+
+        /**
+         * Average number of probes per call
+         */
+        double averageProbes() const {
+            return calls == 0 ? 0.0 : static_cast<double>(totalProbes) / calls;
+        }
+
+        /**
+         * Calls per probe count (last bucket collects everything deeper)
+         */
+        const std::vector<size_t>& getProbeHistogram() const {
+            return probeHistogram;
+        }
+
+        /**
+         * Calls per depth at which an equal key was first seen
+         */
+        const std::vector<size_t>& getFirstHitHistogram() const {
+            return firstHitHistogram;
+        }
+
+        /**
+         * Calls per number of probes made after the first hit
+         */
+        const std::vector<size_t>& getEqualRangeHistogram() const {
+            return equalRangeHistogram;
+        }
+
+        /**
+         * Sampled latencies in nanoseconds, in recording order
+         */
+        const std::vector<uint64_t>& getLatencySamples() const {
+            return latencySamples;
+        }
+
+        /**
+         * Latency percentile over the collected samples
+         * @param p Percentile in [0, 100]
+         * @return Latency in nanoseconds, 0 if nothing was sampled
+         */
+        uint64_t latencyPercentile(double p) const {
+            if (latencySamples.empty()) return 0;
+            std::vector<uint64_t> sorted = latencySamples;
+            std::sort(sorted.begin(), sorted.end());
+            size_t rank = static_cast<size_t>(p / 100.0 * (sorted.size() - 1) + 0.5);
+            return sorted[std::min(rank, sorted.size() - 1)];
+        }
+
+        /**
+         * Write all histograms as CSV rows: histogram,depth,count
+         */
+        void exportHistograms(std::ostream& out) const {
+            out << "histogram,depth,count" << std::endl;
+            writeHistogram(out, "probes", probeHistogram);
+            writeHistogram(out, "first_hit", firstHitHistogram);
+            writeHistogram(out, "equal_range", equalRangeHistogram);
+        }
+
+        /**
+         * Print a short summary (for debugging)
+         */
+        void display() const {
+            std::cout << "Searches: " << calls
+                      << " (found: " << found << ", not found: " << getNotFound() << ")"
+                      << ", avg probes: " << averageProbes()
+                      << ", p50 latency: " << latencyPercentile(50) << "ns"
+                      << ", p99 latency: " << latencyPercentile(99) << "ns" << std::endl;
+        }
+
+        /**
+         * Forget everything recorded so far
+         */
+        void reset() {
+            calls = found = totalProbes = 0;
+            std::fill(probeHistogram.begin(), probeHistogram.end(), 0);
+            std::fill(firstHitHistogram.begin(), firstHitHistogram.end(), 0);
+            std::fill(equalRangeHistogram.begin(), equalRangeHistogram.end(), 0);
+            latencySamples.clear();
+        }
+
+    private:
+        static void writeHistogram(std::ostream& out, const char* name, const std::vector<size_t>& histogram) {
+            for (size_t depth = 0; depth < histogram.size(); ++depth) {
+                if (histogram[depth] != 0) {
+                    out << name << "," << depth << "," << histogram[depth] << std::endl;
+                }
+            }
+        }
+    };
+}
+
+#endif // SEARCH_STATS_H
@@ -0,0 +1,362 @@
+#ifndef STATIC_LOOKUP_H
+#define STATIC_LOOKUP_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * Compile-Time Lookup Tables for Small Static Key Sets
+ *
+ * Time Complexity (lookup):
+ * - SortedSet: O(N) branch-free scan for N <= 32, O(log N) branchless search otherwise
+ * - EytzingerSet: O(log N) branchless descent in BFS order
+ * - PerfectHashSet: O(1) - two hashes and one comparison
+ *
+ * Build cost: zero at runtime - every table is built by the compiler
+ * Space Complexity: O(N)
+ *
+ * For key sets known at compile time (opcodes, enum names, ...) there is no
+ * reason to sort a vector at startup. The make* helpers below take a braced
+ * list of keys and produce constexpr tables:
+ *
+ *     constexpr auto ops = StaticLookup::makePerfectHashSet<int>({0x10, 0x20, 0x2f});
+ *     static_assert(ops.find(0x20) != -1);
+ *
+ * Supported keys: integral types, enums and std::string_view.
+ */
+
+namespace StaticLookup {
+
+    /**
+     * Sets at or below this size are searched with a linear scan, which the
+     * compiler vectorizes and which beats a dependent chain of probes
+     */
+    constexpr size_t LINEAR_SCAN_LIMIT = 32;
+
+    /**
+     * 64-bit finalizer (splitmix64) used by the perfect hash
+     */
+    constexpr uint64_t mix(uint64_t x) {
+        x += 0x9e3779b97f4a7c15ULL;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
+    }
+
+    /**
+     * Seeded hash for integral and enum keys
+     */
+    template<typename T>
+    constexpr uint64_t hashKey(const T& key, uint64_t seed) {
+        static_assert(std::is_integral_v<T> || std::is_enum_v<T>,
+                      "StaticLookup keys must be integral, enum or std::string_view");
+        return mix(static_cast<uint64_t>(key) ^ mix(seed));
+    }
+
+    /**
+     * Seeded hash for string keys (FNV-1a, then mixed)
+     */
+    constexpr uint64_t hashKey(std::string_view key, uint64_t seed) {
+        uint64_t h = 0xcbf29ce484222325ULL ^ mix(seed);
+        for (char c : key) {
+            h ^= static_cast<unsigned char>(c);
+            h *= 0x100000001b3ULL;
+        }
+        return mix(h);
+    }
+
+    /**
+     * Constexpr insertion sort (std::sort is not constexpr before C++20)
+     */
+    template<typename T, size_t N>
+    constexpr std::array<T, N> sortedCopy(const T (&keys)[N]) {
+        std::array<T, N> result{};
+        for (size_t i = 0; i < N; ++i) {
+            result[i] = keys[i];
+        }
+        for (size_t i = 1; i < N; ++i) {
+            T value = result[i];
+            size_t j = i;
+            while (j > 0 && value < result[j - 1]) {
+                result[j] = result[j - 1];
+                j--;
+            }
+            result[j] = value;
+        }
+        return result;
+    }
+
+    /**
+     * Reject repeated keys in a sorted array
+     * @throws std::invalid_argument on duplicate keys (a compile error in constexpr context)
+     */
+    template<typename T, size_t N>
+    constexpr void requireUnique(const std::array<T, N>& sorted) {
+        for (size_t i = 1; i < N; ++i) {
+            if (sorted[i] == sorted[i - 1]) {
+                throw std::invalid_argument("Duplicate key in static set");
+            }
+        }
+    }
+
+    /**
+     * Sorted array searched with a branch-free scan or branchless binary search
+     */
+    template<typename T, size_t N>
+    class SortedSet {
+    private:
+        std::array<T, N> keys;
+
+    public:
+        /**
+         * @throws std::invalid_argument on duplicate keys (a compile error in constexpr context)
+         */
+        constexpr explicit SortedSet(const std::array<T, N>& sorted) : keys(sorted) {
+            requireUnique(sorted);
+        }
+
+        /**
+         * Find index of key
+         * @param key Value to search for
+         * @return Index in sorted order, -1 if not present
+         */
+        constexpr int find(const T& key) const {
+            size_t index = lowerBound(key);
+            bool found = index < N && keys[index == N ? 0 : index] == key;
+            return found ? static_cast<int>(index) : -1;
+        }
+
+        /**
+         * Index of first key not less than key
+         */
+        constexpr size_t lowerBound(const T& key) const {
+            if constexpr (N == 0) {
+                return 0;
+            } else if constexpr (N <= LINEAR_SCAN_LIMIT) {
+                // Count smaller keys: no early exit, so it becomes one vector compare
+                size_t count = 0;
+                for (size_t i = 0; i < N; ++i) {
+                    count += keys[i] < key;
+                }
+                return count;
+            } else {
+                size_t base = 0;
+                size_t n = N;
+                while (n > 1) {
+                    size_t half = n / 2;
+                    base = (keys[base + half] < key) ? base + half : base;
+                    n -= half;
+                }
+                return base + (keys[base] < key);
+            }
+        }
+
+        constexpr bool contains(const T& key) const {
+            return find(key) != -1;
+        }
+
+        constexpr const T& keyAt(size_t index) const {
+            return keys[index];
+        }
+
+        static constexpr size_t size() {
+            return N;
+        }
+    };
+
+    /**
+     * Keys in Eytzinger (BFS) order, searched with a branchless descent
+     */
+    template<typename T, size_t N>
+    class EytzingerSet {
+    private:
+        std::array<T, N + 1> tree{};          // 1-based, slot 0 unused
+        std::array<size_t, N + 1> rank{};     // Slot -> index in sorted order
+
+    public:
+        /**
+         * @throws std::invalid_argument on duplicate keys (a compile error in constexpr context)
+         */
+        constexpr explicit EytzingerSet(const std::array<T, N>& sorted) {
+            requireUnique(sorted);
+            size_t next = 0;
+            fill(sorted, 1, next);
+        }
+
+        /**
+         * Find sorted-order index of key
+         * @param key Value to search for
+         * @return Index in sorted order, -1 if not present
+         */
+        constexpr int find(const T& key) const {
+            size_t slot = 1;
+            while (slot <= N) {
+                slot = 2 * slot + (tree[slot] < key);
+            }
+
+            // Undo trailing right turns plus the last left turn
+            while (slot & 1) {
+                slot >>= 1;
+            }
+            slot >>= 1;
+
+            bool found = slot != 0 && tree[slot] == key;
+            return found ? static_cast<int>(rank[slot]) : -1;
+        }
+
+        constexpr bool contains(const T& key) const {
+            return find(key) != -1;
+        }
+
+        static constexpr size_t size() {
+            return N;
+        }
+
+    private:
+        constexpr void fill(const std::array<T, N>& sorted, size_t slot, size_t& next) {
+            if (slot > N) return;
+            fill(sorted, 2 * slot, next);
+            tree[slot] = sorted[next];
+            rank[slot] = next;
+            next++;
+            fill(sorted, 2 * slot + 1, next);
+        }
+    };
+
+    /**
+     * Minimal perfect hash (hash-and-displace): N keys in exactly N slots
+     * A first hash picks a bucket, the bucket's displacement seeds a second
+     * hash that lands on the key's unique slot
+     */
+    template<typename T, size_t N>
+    class PerfectHashSet {
+        static_assert(N > 0, "PerfectHashSet needs at least one key");
+
+    private:
+        static constexpr uint32_t MAX_DISPLACEMENT = 1u << 16;
+
+        std::array<T, N> table{};              // table[slot] = key stored there
+        std::array<uint32_t, N> displacement{};  // Per-bucket seed of the second hash
+
+    public:
+        /**
+         * Build the table at compile time
+         * @throws std::invalid_argument on duplicate keys (a compile error in constexpr context)
+         */
+        constexpr explicit PerfectHashSet(const std::array<T, N>& sorted) {
+            requireUnique(sorted);
+
+            std::array<size_t, N> bucketSize{};
+            for (size_t i = 0; i < N; ++i) {
+                bucketSize[bucketOf(sorted[i])]++;
+            }
+
+            // Place the biggest buckets first, while most slots are free
+            std::array<bool, N> taken{};
+            std::array<bool, N> placed{};
+            for (size_t round = 0; round < N; ++round) {
+                size_t bucket = 0;
+                size_t largest = 0;
+                for (size_t b = 0; b < N; ++b) {
+                    if (!placed[b] && bucketSize[b] >= largest) {
+                        bucket = b;
+                        largest = bucketSize[b];
+                    }
+                }
+                placed[bucket] = true;
+                if (largest == 0) continue;
+
+                uint32_t d = 1;
+                while (!tryPlace(sorted, bucket, d, taken)) {
+                    if (++d == MAX_DISPLACEMENT) {
+                        throw std::invalid_argument("No perfect hash found for static set");
+                    }
+                }
+                displacement[bucket] = d;
+            }
+        }
+
+        /**
+         * Find slot of key
+         * @param key Value to search for
+         * @return Slot index in [0, N), -1 if not present
+         */
+        constexpr int find(const T& key) const {
+            size_t slot = slotOf(key, displacement[bucketOf(key)]);
+            return table[slot] == key ? static_cast<int>(slot) : -1;
+        }
+
+        constexpr bool contains(const T& key) const {
+            return find(key) != -1;
+        }
+
+        constexpr const T& keyAt(size_t slot) const {
+            return table[slot];
+        }
+
+        static constexpr size_t size() {
+            return N;
+        }
+
+    private:
+        static constexpr size_t bucketOf(const T& key) {
+            return static_cast<size_t>(hashKey(key, 0) % N);
+        }
+
+        static constexpr size_t slotOf(const T& key, uint32_t d) {
+            return static_cast<size_t>(hashKey(key, d) % N);
+        }
+
+        /**
+         * Try displacement d for every key of a bucket; commit if all slots are free
+         */
+        constexpr bool tryPlace(const std::array<T, N>& keys, size_t bucket, uint32_t d,
+                                std::array<bool, N>& taken) {
+            std::array<bool, N> claimed{};
+            for (size_t i = 0; i < N; ++i) {
+                if (bucketOf(keys[i]) != bucket) continue;
+                size_t slot = slotOf(keys[i], d);
+                if (taken[slot] || claimed[slot]) return false;
+                claimed[slot] = true;
+            }
+
+            for (size_t i = 0; i < N; ++i) {
+                if (bucketOf(keys[i]) != bucket) continue;
+                size_t slot = slotOf(keys[i], d);
+                taken[slot] = true;
+                table[slot] = keys[i];
+            }
+            return true;
+        }
+    };
+
+    /**
+     * Build a constexpr sorted set from a braced list of keys
+     */
+    template<typename T, size_t N>
+    constexpr SortedSet<T, N> makeSortedSet(const T (&keys)[N]) {
+        return SortedSet<T, N>(sortedCopy(keys));
+    }
+
+    /**
+     * Build a constexpr Eytzinger-ordered set from a braced list of keys
+     */
+    template<typename T, size_t N>
+    constexpr EytzingerSet<T, N> makeEytzingerSet(const T (&keys)[N]) {
+        return EytzingerSet<T, N>(sortedCopy(keys));
+    }
+
+    /**
+     * Build a constexpr minimal perfect hash set from a braced list of keys
+     */
+    template<typename T, size_t N>
+    constexpr PerfectHashSet<T, N> makePerfectHashSet(const T (&keys)[N]) {
+        return PerfectHashSet<T, N>(sortedCopy(keys));
+    }
+}
+
+#endif // STATIC_LOOKUP_H
@@ -0,0 +1,281 @@
+/**
+ * Stress test and throughput benchmark for the concurrent sorted lists
+ *
+ * Compares three sets of ints under concurrent use:
+ * - MutexSortedList: LinkedList kept sorted, guarded by one global mutex
+ * - ConcurrentSortedList: lock-free Harris-Michael list
+ * - OptimisticSortedList: optimistic traversal with versioned node locks
+ *
+ * The stress phase checks each list for lost or duplicated elements under
+ * contention, and the benchmark times mixes of contains / insert / remove
+ * at several thread counts.
+ *
+ * Build and run (from the repository root):
+ *     g++ -std=c++17 -O2 -pthread cpp/benchmarks/sorted_list_bench.cpp -o sorted_list_bench
+ *     ./sorted_list_bench [stress|bench] [ops per thread]
+ *
+ * Add -fsanitize=thread (or address) to run the stress phase under a
+ * sanitizer.
+ */
+
+#include <set>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include "../data_structures/linked_list.h"
+#include "../data_structures/concurrent_sorted_list.h"
+#include "../data_structures/optimistic_sorted_list.h"
+
+/**
+ * Baseline: a sorted LinkedList behind a single mutex
+ */
+template <typename T>
+class MutexSortedList {
+private:
+    LinkedList<T> list;
+    std::mutex mutex;
+
+public:
+    bool insert(const T& value) {
+        std::lock_guard<std::mutex> lock(mutex);
+        typename LinkedList<T>::iterator prev = list.end();
+        typename LinkedList<T>::iterator current = list.begin();
+        while (current != list.end() && *current < value) {
+            prev = current++;
+        }
+        if (current != list.end() && !(value < *current)) {
+            return false;
+        }
+        if (prev == list.end()) {
+            list.pushFront(value);
+        } else {
+            list.insertAfter(prev, value);
+        }
+        return true;
+    }
+
+    bool remove(const T& value) {
+        std::lock_guard<std::mutex> lock(mutex);
+        typename LinkedList<T>::iterator prev = list.end();
+        typename LinkedList<T>::iterator current = list.begin();
+        while (current != list.end() && *current < value) {
+            prev = current++;
+        }
+        if (current == list.end() || value < *current) {
+            return false;
+        }
+        if (prev == list.end()) {
+            list.popFront();
+        } else {
+            list.eraseAfter(prev);
+        }
+        return true;
+    }
+
+    bool contains(const T& value) {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const T& item : list) {
+            if (!(item < value)) {
+                return !(value < item);
+            }
+        }
+        return false;
+    }
+
+    std::vector<T> toVector() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return std::vector<T>(list.begin(), list.end());
+    }
+
+    size_t getSize() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return list.getSize();
+    }
+};
+
+/**
+ * Run body(threadIndex) on threads threads, released together
+ * @return Wall-clock seconds from release until every thread finished
+ */
+static double runThreads(int threads, const std::function<void(int)>& body) {
+    std::atomic<int> ready(0);
+    std::atomic<bool> go(false);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            ready.fetch_add(1);
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            body(t);
+        });
+    }
+    while (ready.load() < threads) {
+        std::this_thread::yield();
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static int failures = 0;
+
+static void check(bool condition, const std::string& name, const char* what) {
+    if (!condition) {
+        std::printf("  FAIL %s: %s\n", name.c_str(), what);
+        failures++;
+    }
+}
+
+/**
+ * Contention test
+ *
+ * Odd keys are inserted up front and never removed, so every contains on
+ * them must succeed. Each thread also owns the even keys k with
+ * (k / 2) % threads == its index and tracks them in a private model, so the
+ * final contents are known exactly even though all threads traverse and
+ * relink the same region of the list.
+ */
+template <typename List>
+static void stress(const std::string& name, int threads, size_t opsPerThread) {
+    const int range = 256;
+    int failuresBefore = failures;
+    List list;
+    for (int key = 1; key < range; key += 2) {
+        list.insert(key);
+    }
+
+    std::vector<std::set<int>> models(threads);
+    std::atomic<int> missedAnchors(0);
+    std::atomic<int> wrongResults(0);
+
+    runThreads(threads, [&](int t) {
+        std::mt19937 rng(static_cast<unsigned>(t) * 7919u + 1u);
+        std::set<int>& model = models[t];
+        for (size_t i = 0; i < opsPerThread; ++i) {
+            int anchor = static_cast<int>(rng() % (range / 2)) * 2 + 1;
+            if (!list.contains(anchor)) {
+                missedAnchors.fetch_add(1);
+            }
+
+            int slot = static_cast<int>(rng() % (range / 2 / threads));
+            int key = (slot * threads + t) * 2;
+            bool inModel = model.count(key) != 0;
+            switch (rng() % 3) {
+            case 0:
+                if (list.insert(key) == inModel) {
+                    wrongResults.fetch_add(1);
+                }
+                model.insert(key);
+                break;
+            case 1:
+                if (list.remove(key) != inModel) {
+                    wrongResults.fetch_add(1);
+                }
+                model.erase(key);
+                break;
+            default:
+                if (list.contains(key) != inModel) {
+                    wrongResults.fetch_add(1);
+                }
+                break;
+            }
+        }
+    });
+
+    std::set<int> expected;
+    for (int key = 1; key < range; key += 2) {
+        expected.insert(key);
+    }
+    for (const std::set<int>& model : models) {
+        expected.insert(model.begin(), model.end());
+    }
+    std::vector<int> contents = list.toVector();
+
+    check(missedAnchors.load() == 0, name, "contains missed a key that was never removed");
+    check(wrongResults.load() == 0, name, "insert / remove / contains disagreed with the owner's model");
+    check(contents == std::vector<int>(expected.begin(), expected.end()), name, "final contents differ from the models");
+    check(list.getSize() == contents.size(), name, "size differs from the element count");
+    std::printf("  %-22s %2d threads  %s\n", name.c_str(), threads, failures == failuresBefore ? "ok" : "FAILED");
+}
+
+/**
+ * Time opsPerThread operations per thread at readPercent% contains; the
+ * rest are split evenly between insert and remove of random keys, so the
+ * list stays about half full
+ */
+template <typename List>
+static void bench(const std::string& name, int threads, int readPercent, size_t opsPerThread) {
+    const int range = 1024;
+    List list;
+    for (int key = 0; key < range; key += 2) {
+        list.insert(key);
+    }
+
+    // Results are summed so the compiler cannot drop a side-effect-free traversal
+    std::atomic<size_t> hits(0);
+    double seconds = runThreads(threads, [&](int t) {
+        std::mt19937 rng(static_cast<unsigned>(t) + 1u);
+        size_t localHits = 0;
+        for (size_t i = 0; i < opsPerThread; ++i) {
+            int key = static_cast<int>(rng() % range);
+            int op = static_cast<int>(rng() % 100);
+            if (op < readPercent) {
+                localHits += list.contains(key);
+            } else if (op % 2 == 0) {
+                localHits += list.insert(key);
+            } else {
+                localHits += list.remove(key);
+            }
+        }
+        hits.fetch_add(localHits);
+    });
+
+    double mops = static_cast<double>(opsPerThread) * threads / seconds / 1e6;
+    std::printf("  %-22s %7d %6d%% %10.2f %10zu\n", name.c_str(), threads, readPercent, mops, hits.load());
+}
+
+int main(int argc, char* argv[]) {
+    std::string mode = argc > 1 ? argv[1] : "all";
+    size_t ops = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 200000;
+    const int threadCounts[] = {1, 2, 4, 8};
+    const int readPercents[] = {90, 50, 10};
+
+    if (mode == "all" || mode == "stress") {
+        std::printf("Stress (%zu ops per thread)\n", ops);
+        for (int threads : {2, 8}) {
+            stress<MutexSortedList<int>>("MutexSortedList", threads, ops);
+            stress<ConcurrentSortedList<int>>("ConcurrentSortedList", threads, ops);
+            stress<OptimisticSortedList<int>>("OptimisticSortedList", threads, ops);
+        }
+    }
+
+    if (mode == "all" || mode == "bench") {
+        std::printf("\nThroughput (%zu ops per thread, 1024 keys, about half present)\n", ops);
+        std::printf("  %-22s %7s %7s %10s %10s\n", "list", "threads", "reads", "Mops/s", "hits");
+        for (int readPercent : readPercents) {
+            for (int threads : threadCounts) {
+                bench<MutexSortedList<int>>("MutexSortedList", threads, readPercent, ops);
+                bench<ConcurrentSortedList<int>>("ConcurrentSortedList", threads, readPercent, ops);
+                bench<OptimisticSortedList<int>>("OptimisticSortedList", threads, readPercent, ops);
+            }
+        }
+    }
+
+    if (failures != 0) {
+        std::printf("\n%d check(s) failed\n", failures);
+        return 1;
+    }
+    return 0;
+}
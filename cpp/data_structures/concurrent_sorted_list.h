@@ -0,0 +1,279 @@
+#ifndef CONCURRENT_SORTED_LIST_H
+#define CONCURRENT_SORTED_LIST_H
+
+#include <atomic>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <iostream>
+#include <functional>
+#include "epoch_manager.h"
+
+/**
+ * Lock-Free Sorted Linked List (Harris-Michael set)
+ *
+ * Time Complexity:
+ * - Insert: O(n), lock-free
+ * - Remove: O(n), lock-free
+ * - Contains: O(n), wait-free (never retries, never writes shared memory)
+ *
+ * Space Complexity: O(n) plus nodes awaiting reclamation
+ *
+ * Elements are kept sorted and unique, and any number of threads may call
+ * insert, remove and contains concurrently without a lock. Removal takes
+ * two steps. First the victim's next pointer is marked (its low bit is
+ * set), which deletes it logically and stops anyone linking after it.
+ * Then it is unlinked from its predecessor. Writers that pass a marked
+ * node help unlink it. contains only reads: it skips marked nodes and
+ * never helps.
+ *
+ * An unlinked node is retired through an EpochManager. Every operation
+ * pins the calling thread, so a node is freed only after every thread
+ * that might still be traversing it has finished. Nodes are allocated with
+ * new because NodePool is not thread-safe.
+ */
+template <typename T, typename Compare = std::less<T>>
+class ConcurrentSortedList {
+private:
+    /**
+     * Node structure; the low bit of next marks the node as deleted
+     */
+    struct Node {
+        T key;
+        std::atomic<uintptr_t> next;
+
+        Node(const T& value, uintptr_t successor) : key(value), next(successor) {}
+    };
+
+    static constexpr uintptr_t MARK = 1;
+
+    std::atomic<uintptr_t> head;    // First node (never marked)
+    std::atomic<size_t> size;       // Element count (exact when quiescent)
+    Compare compare;
+    EpochManager epochs;            // Reclaims unlinked nodes
+
+    static Node* toNode(uintptr_t word) {
+        return reinterpret_cast<Node*>(word & ~MARK);
+    }
+
+    static uintptr_t toWord(Node* node) {
+        return reinterpret_cast<uintptr_t>(node);
+    }
+
+    static bool isMarked(uintptr_t word) {
+        return (word & MARK) != 0;
+    }
+
+    /**
+     * Result of find: the link to update and the first unmarked node not
+     * ordered before the key (nullptr if none)
+     */
+    struct Window {
+        std::atomic<uintptr_t>* prev;
+        Node* curr;
+    };
+
+public:
+    /**
+     * Constructor - Initialize empty list
+     */
+    explicit ConcurrentSortedList(const Compare& comp = Compare()) : head(0), size(0), compare(comp) {}
+
+    ConcurrentSortedList(const ConcurrentSortedList&) = delete;
+    ConcurrentSortedList& operator=(const ConcurrentSortedList&) = delete;
+
+    /**
+     * Destructor - No thread may be using the list any more
+     */
+    ~ConcurrentSortedList() {
+        Node* current = toNode(head.load(std::memory_order_relaxed));
+        while (current != nullptr) {
+            Node* next = toNode(current->next.load(std::memory_order_relaxed));
+            delete current;
+            current = next;
+        }
+    }
+
+    /**
+     * Add value if it is not already present
+     * @return true if inserted, false if an equal element exists
+     */
+    bool insert(const T& value) {
+        EpochManager::Handle& handle = epochs.local();
+        EpochManager::Guard guard = handle.pin();
+
+        Node* node = nullptr;
+        while (true) {
+            Window window = find(value, handle);
+            if (window.curr != nullptr && !compare(value, window.curr->key)) {
+                delete node;
+                return false;
+            }
+
+            uintptr_t expected = toWord(window.curr);
+            if (node == nullptr) {
+                node = new Node(value, expected);
+            } else {
+                node->next.store(expected, std::memory_order_relaxed);
+            }
+
+            if (window.prev->compare_exchange_strong(expected, toWord(node),
+                                                     std::memory_order_acq_rel, std::memory_order_acquire)) {
+                size.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+    }
+
+    /**
+     * Remove value
+     * @return true if this call removed it, false if it was not present
+     */
+    bool remove(const T& value) {
+        EpochManager::Handle& handle = epochs.local();
+        EpochManager::Guard guard = handle.pin();
+
+        while (true) {
+            Window window = find(value, handle);
+            if (window.curr == nullptr || compare(value, window.curr->key)) {
+                return false;
+            }
+
+            // Logical deletion: mark the victim's next pointer
+            Node* victim = window.curr;
+            uintptr_t next = victim->next.load(std::memory_order_acquire);
+            if (isMarked(next)) {
+                continue;   // Another remover won; find will help unlink it
+            }
+            if (!victim->next.compare_exchange_strong(next, next | MARK,
+                                                      std::memory_order_acq_rel, std::memory_order_acquire)) {
+                continue;
+            }
+            size.fetch_sub(1, std::memory_order_relaxed);
+
+            // Physical deletion; on failure a later find unlinks it
+            uintptr_t expected = toWord(victim);
+            if (window.prev->compare_exchange_strong(expected, next,
+                                                     std::memory_order_acq_rel, std::memory_order_acquire)) {
+                handle.retire(victim);
+            } else {
+                find(value, handle);
+            }
+            return true;
+        }
+    }
+
+    /**
+     * Check if value is present (wait-free, read-only)
+     */
+    bool contains(const T& value) {
+        EpochManager::Guard guard = epochs.local().pin();
+
+        Node* current = toNode(head.load(std::memory_order_acquire));
+        while (current != nullptr && compare(current->key, value)) {
+            current = toNode(current->next.load(std::memory_order_acquire));
+        }
+        return current != nullptr && !compare(value, current->key) &&
+               !isMarked(current->next.load(std::memory_order_acquire));
+    }
+
+    /**
+     * Visit every present element in order
+     * Weakly consistent: concurrent updates may or may not be observed
+     */
+    template <typename Func>
+    void forEach(Func visit) {
+        EpochManager::Guard guard = epochs.local().pin();
+
+        Node* current = toNode(head.load(std::memory_order_acquire));
+        while (current != nullptr) {
+            uintptr_t next = current->next.load(std::memory_order_acquire);
+            if (!isMarked(next)) {
+                visit(current->key);
+            }
+            current = toNode(next);
+        }
+    }
+
+    /**
+     * Copy present elements into a vector (weakly consistent, see forEach)
+     */
+    std::vector<T> toVector() {
+        std::vector<T> result;
+        forEach([&](const T& key) { result.push_back(key); });
+        return result;
+    }
+
+    /**
+     * Get number of elements (may lag behind concurrent updates)
+     */
+    size_t getSize() const {
+        return size.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Check if list is empty (may lag behind concurrent updates)
+     */
+    bool isEmpty() const {
+        return getSize() == 0;
+    }
+
+    /**
+     * Display list contents (for debugging)
+     */
+    void display() {
+        std::vector<T> items = toVector();
+        if (items.empty()) {
+            std::cout << "List is empty" << std::endl;
+            return;
+        }
+
+        std::cout << "List: ";
+        for (size_t i = 0; i < items.size(); ++i) {
+            std::cout << items[i];
+            if (i + 1 < items.size()) {
+                std::cout << " -> ";
+            }
+        }
+        std::cout << " (size: " << items.size() << ")" << std::endl;
+    }
+
+private:
+    /**
+     * Locate the window for value, unlinking marked nodes on the way
+     * The caller must be pinned
+     */
+    Window find(const T& value, EpochManager::Handle& handle) {
+    retry:
+        std::atomic<uintptr_t>* prev = &head;
+        uintptr_t curr = prev->load(std::memory_order_acquire);
+
+        while (true) {
+            Node* node = toNode(curr);
+            if (node == nullptr) {
+                return {prev, nullptr};
+            }
+
+            uintptr_t next = node->next.load(std::memory_order_acquire);
+            if (isMarked(next)) {
+                // Help: unlink the logically deleted node
+                uintptr_t expected = curr;
+                if (!prev->compare_exchange_strong(expected, next & ~MARK,
+                                                   std::memory_order_acq_rel, std::memory_order_acquire)) {
+                    goto retry;   // prev changed or was itself marked
+                }
+                handle.retire(node);
+                curr = next & ~MARK;
+                continue;
+            }
+
+            if (!compare(node->key, value)) {
+                return {prev, node};
+            }
+            prev = &node->next;
+            curr = next;
+        }
+    }
+};
+
+#endif // CONCURRENT_SORTED_LIST_H
@@ -0,0 +1,561 @@
+#ifndef DOUBLY_LINKED_LIST_H
+#define DOUBLY_LINKED_LIST_H
+
+#include <new>
+#include <memory>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <iostream>
+#include <stdexcept>
+#include <initializer_list>
+#include "node_pool.h"
+
+/**
+ * Doubly Linked List Implementation in C++
+ *
+ * Time Complexity:
+ * - Insert at head / tail: O(1)
+ * - Insert before iterator: O(1)
+ * - Insert at index: O(min(i, n - i))
+ * - Delete at head / tail: O(1)
+ * - Delete at iterator: O(1)
+ * - Delete at index: O(min(i, n - i))
+ * - Search: O(n)
+ * - Access by index: O(min(i, n - i)) - walks from the nearer end
+ *
+ * Space Complexity: O(n), one extra pointer per node compared to LinkedList
+ *
+ * Each node links to its predecessor as well as its successor, so popBack
+ * and removal at an iterator no longer walk from the head. Nodes come from
+ * a NodePool, as in LinkedList. Each list's private pool starts with a slab
+ * of a few nodes and grows geometrically, so millions of short lists do
+ * not each hold a full-size slab.
+ */
+template <typename T>
+class DoublyLinkedList {
+private:
+    /**
+     * Node structure for the doubly linked list
+     */
+    struct Node {
+        T data;
+        Node* prev;
+        Node* next;
+
+        Node(const T& value) : data(value), prev(nullptr), next(nullptr) {}
+    };
+
+    Node* head;     // Pointer to first node
+    Node* tail;     // Pointer to last node
+    size_t size;    // Current number of elements
+    std::shared_ptr<NodePool> pool;  // Source of node memory
+
+public:
+    /**
+     * Bidirectional iterator over list elements
+     * IsConst selects between iterator and const_iterator
+     */
+    template <bool IsConst>
+    class Iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+
+        Iterator() : node(nullptr), list(nullptr) {}
+
+        template <bool WasConst, typename = std::enable_if_t<IsConst && !WasConst>>
+        Iterator(const Iterator<WasConst>& other) : node(other.node), list(other.list) {}
+
+        reference operator*() const {
+            return node->data;
+        }
+
+        pointer operator->() const {
+            return &node->data;
+        }
+
+        Iterator& operator++() {
+            node = node->next;
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator old = *this;
+            node = node->next;
+            return old;
+        }
+
+        /**
+         * Decrementing end() yields the last element
+         */
+        Iterator& operator--() {
+            node = node == nullptr ? list->tail : node->prev;
+            return *this;
+        }
+
+        Iterator operator--(int) {
+            Iterator old = *this;
+            --*this;
+            return old;
+        }
+
+        friend bool operator==(const Iterator& a, const Iterator& b) {
+            return a.node == b.node;
+        }
+
+        friend bool operator!=(const Iterator& a, const Iterator& b) {
+            return a.node != b.node;
+        }
+
+    private:
+        friend class DoublyLinkedList;
+
+        Node* node;
+        const DoublyLinkedList* list;
+
+        Iterator(Node* n, const DoublyLinkedList* l) : node(n), list(l) {}
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /**
+     * Create a node pool suitable for sharing between lists of this type
+     * @param nodesPerSlab Nodes per slab (0 = pool default)
+     */
+    static std::shared_ptr<NodePool> makePool(size_t nodesPerSlab = 0) {
+        return std::make_shared<NodePool>(sizeof(Node), alignof(Node), nodesPerSlab);
+    }
+
+    /**
+     * Constructor - Initialize empty list
+     */
+    DoublyLinkedList() : head(nullptr), tail(nullptr), size(0), pool(makePool()) {}
+
+    /**
+     * Constructor - Initialize empty list drawing nodes from a shared pool
+     * @throws std::invalid_argument if the pool is null or its nodes are too small
+     */
+    explicit DoublyLinkedList(std::shared_ptr<NodePool> sharedPool)
+        : head(nullptr), tail(nullptr), size(0), pool(std::move(sharedPool)) {
+        if (!pool || !pool->fits(sizeof(Node), alignof(Node))) {
+            throw std::invalid_argument("Pool cannot hold list nodes");
+        }
+    }
+
+    /**
+     * Constructor with initializer list
+     */
+    DoublyLinkedList(std::initializer_list<T> init) : head(nullptr), tail(nullptr), size(0), pool(makePool()) {
+        for (const auto& item : init) {
+            pushBack(item);
+        }
+    }
+
+    /**
+     * Copy constructor (the copy gets its own pool)
+     */
+    DoublyLinkedList(const DoublyLinkedList& other) : head(nullptr), tail(nullptr), size(0), pool(makePool()) {
+        copyFrom(other);
+    }
+
+    /**
+     * Assignment operator
+     */
+    DoublyLinkedList& operator=(const DoublyLinkedList& other) {
+        if (this != &other) {
+            clear();
+            copyFrom(other);
+        }
+        return *this;
+    }
+
+    /**
+     * Destructor - Clean up all nodes
+     */
+    ~DoublyLinkedList() {
+        clear();
+    }
+
+    /**
+     * Add element to the front of the list
+     */
+    void pushFront(const T& value) {
+        insert(begin(), value);
+    }
+
+    /**
+     * Add element to the back of the list
+     */
+    void pushBack(const T& value) {
+        insert(end(), value);
+    }
+
+    /**
+     * Insert element at specific index
+     * @throws std::out_of_range if index is invalid
+     */
+    void insert(size_t index, const T& value) {
+        if (index > size) {
+            throw std::out_of_range("Index out of range");
+        }
+        insert(const_iterator(index == size ? nullptr : nodeAt(index), this), value);
+    }
+
+    /**
+     * Insert element before pos
+     * @param pos Position to insert before (end() appends)
+     * @param value Element to insert
+     * @return Iterator to the inserted element
+     */
+    iterator insert(const_iterator pos, const T& value) {
+        Node* newNode = createNode(value);
+        Node* next = pos.node;
+        Node* prev = next != nullptr ? next->prev : tail;
+
+        newNode->prev = prev;
+        newNode->next = next;
+        if (prev != nullptr) {
+            prev->next = newNode;
+        } else {
+            head = newNode;
+        }
+        if (next != nullptr) {
+            next->prev = newNode;
+        } else {
+            tail = newNode;
+        }
+        size++;
+        return iterator(newNode, this);
+    }
+
+    /**
+     * Remove element at pos
+     * @return Iterator to the element after the removed one
+     * @throws std::out_of_range if pos is end()
+     */
+    iterator erase(const_iterator pos) {
+        if (pos.node == nullptr) {
+            throw std::out_of_range("Iterator out of range");
+        }
+        Node* next = pos.node->next;
+        unlinkAndDestroy(pos.node);
+        return iterator(next, this);
+    }
+
+    /**
+     * Remove element from the front of the list
+     * @throws std::underflow_error if list is empty
+     */
+    T popFront() {
+        if (isEmpty()) {
+            throw std::underflow_error("List is empty");
+        }
+        T value = head->data;
+        unlinkAndDestroy(head);
+        return value;
+    }
+
+    /**
+     * Remove element from the back of the list
+     * @throws std::underflow_error if list is empty
+     */
+    T popBack() {
+        if (isEmpty()) {
+            throw std::underflow_error("List is empty");
+        }
+        T value = tail->data;
+        unlinkAndDestroy(tail);
+        return value;
+    }
+
+    /**
+     * Remove element at specific index
+     * @throws std::out_of_range if index is invalid
+     */
+    T removeAt(size_t index) {
+        if (index >= size) {
+            throw std::out_of_range("Index out of range");
+        }
+        Node* node = nodeAt(index);
+        T value = node->data;
+        unlinkAndDestroy(node);
+        return value;
+    }
+
+    /**
+     * Remove first occurrence of value
+     * @return true if element was found and removed, false otherwise
+     */
+    bool remove(const T& value) {
+        for (Node* current = head; current != nullptr; current = current->next) {
+            if (current->data == value) {
+                unlinkAndDestroy(current);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Get element at specific index
+     * @throws std::out_of_range if index is invalid
+     */
+    T& at(size_t index) {
+        if (index >= size) {
+            throw std::out_of_range("Index out of range");
+        }
+        return nodeAt(index)->data;
+    }
+
+    const T& at(size_t index) const {
+        if (index >= size) {
+            throw std::out_of_range("Index out of range");
+        }
+        return nodeAt(index)->data;
+    }
+
+    /**
+     * Get first element
+     * @throws std::underflow_error if list is empty
+     */
+    T& front() {
+        if (isEmpty()) {
+            throw std::underflow_error("List is empty");
+        }
+        return head->data;
+    }
+
+    const T& front() const {
+        if (isEmpty()) {
+            throw std::underflow_error("List is empty");
+        }
+        return head->data;
+    }
+
+    /**
+     * Get last element
+     * @throws std::underflow_error if list is empty
+     */
+    T& back() {
+        if (isEmpty()) {
+            throw std::underflow_error("List is empty");
+        }
+        return tail->data;
+    }
+
+    const T& back() const {
+        if (isEmpty()) {
+            throw std::underflow_error("List is empty");
+        }
+        return tail->data;
+    }
+
+    /**
+     * Find index of first occurrence of value
+     * @return Index of value, or -1 if not found
+     */
+    int find(const T& value) const {
+        int index = 0;
+        for (Node* current = head; current != nullptr; current = current->next) {
+            if (current->data == value) {
+                return index;
+            }
+            index++;
+        }
+        return -1;
+    }
+
+    /**
+     * Check if value exists in the list
+     */
+    bool contains(const T& value) const {
+        return find(value) != -1;
+    }
+
+    /**
+     * Check if list is empty
+     */
+    bool isEmpty() const {
+        return size == 0;
+    }
+
+    /**
+     * Get current size of list
+     */
+    size_t getSize() const {
+        return size;
+    }
+
+    /**
+     * Clear all elements from list
+     * When the pool is not shared its slabs are released as a whole
+     */
+    void clear() {
+        Node* current = head;
+        while (current != nullptr) {
+            Node* next = current->next;
+            destroyNode(current);
+            current = next;
+        }
+        head = tail = nullptr;
+        size = 0;
+        if (pool.use_count() == 1) {
+            pool->release();
+        }
+    }
+
+    /**
+     * Reverse the list
+     */
+    void reverse() {
+        Node* current = head;
+        while (current != nullptr) {
+            Node* next = current->next;
+            std::swap(current->prev, current->next);
+            current = next;
+        }
+        std::swap(head, tail);
+    }
+
+    /**
+     * Display list contents (for debugging)
+     */
+    void display() const {
+        if (isEmpty()) {
+            std::cout << "List is empty" << std::endl;
+            return;
+        }
+
+        std::cout << "List: ";
+        for (Node* current = head; current != nullptr; current = current->next) {
+            std::cout << current->data;
+            if (current->next != nullptr) {
+                std::cout << " <-> ";
+            }
+        }
+        std::cout << " (size: " << size << ")" << std::endl;
+    }
+
+    T& operator[](size_t index) {
+        return at(index);
+    }
+
+    const T& operator[](size_t index) const {
+        return at(index);
+    }
+
+    iterator begin() {
+        return iterator(head, this);
+    }
+
+    iterator end() {
+        return iterator(nullptr, this);
+    }
+
+    const_iterator begin() const {
+        return const_iterator(head, this);
+    }
+
+    const_iterator end() const {
+        return const_iterator(nullptr, this);
+    }
+
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    const_iterator cend() const {
+        return end();
+    }
+
+    reverse_iterator rbegin() {
+        return reverse_iterator(end());
+    }
+
+    reverse_iterator rend() {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rbegin() const {
+        return const_reverse_iterator(end());
+    }
+
+    const_reverse_iterator rend() const {
+        return const_reverse_iterator(begin());
+    }
+
+    /**
+     * Get the pool this list allocates nodes from
+     */
+    const std::shared_ptr<NodePool>& getPool() const {
+        return pool;
+    }
+
+private:
+    /**
+     * Node at index, walking from whichever end is closer
+     */
+    Node* nodeAt(size_t index) const {
+        if (index < size / 2) {
+            Node* current = head;
+            for (size_t i = 0; i < index; ++i) {
+                current = current->next;
+            }
+            return current;
+        }
+
+        Node* current = tail;
+        for (size_t i = size - 1; i > index; --i) {
+            current = current->prev;
+        }
+        return current;
+    }
+
+    void unlinkAndDestroy(Node* node) {
+        if (node->prev != nullptr) {
+            node->prev->next = node->next;
+        } else {
+            head = node->next;
+        }
+        if (node->next != nullptr) {
+            node->next->prev = node->prev;
+        } else {
+            tail = node->prev;
+        }
+        destroyNode(node);
+        size--;
+    }
+
+    Node* createNode(const T& value) {
+        void* memory = pool->allocate();
+        try {
+            return new (memory) Node(value);
+        } catch (...) {
+            pool->deallocate(memory);
+            throw;
+        }
+    }
+
+    void destroyNode(Node* node) {
+        node->~Node();
+        pool->deallocate(node);
+    }
+
+    /**
+     * Helper function to copy from another list
+     */
+    void copyFrom(const DoublyLinkedList& other) {
+        for (Node* current = other.head; current != nullptr; current = current->next) {
+            pushBack(current->data);
+        }
+    }
+};
+
+#endif // DOUBLY_LINKED_LIST_H
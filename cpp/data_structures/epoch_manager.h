@@ -0,0 +1,272 @@
+#ifndef EPOCH_MANAGER_H
+#define EPOCH_MANAGER_H
+
+#include <atomic>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <cstdint>
+#include <cstddef>
+#include <stdexcept>
+
+/**
+ * Epoch-Based Memory Reclamation
+ *
+ * Time Complexity:
+ * - pin / unpin: O(1) - one store each, readers never wait
+ * - retire: O(1) amortized
+ * - collect: O(P + R) where P is the number of slots and R the retired objects
+ *
+ * Space Complexity: O(P + R)
+ *
+ * Lock-free structures cannot delete a node the moment it is unlinked,
+ * because a concurrent reader may still be looking at it. A reader pins
+ * itself to the current global epoch for the duration of an operation.
+ * An unlinked object is retired with the epoch at which it was retired.
+ * It is freed only once every pinned reader started after that epoch,
+ * because any such reader could only reach the new version.
+ *
+ * Each thread works through its own Handle (one slot, private retire list).
+ * Handles keep the shared state alive, so a structure may be destroyed
+ * while other threads still hold handles to its manager.
+ *
+ * Handles created by local() live in a thread_local registry. Destroying
+ * the manager cannot reach other threads' registries, so each thread's
+ * handle outlives the manager. It goes away when the thread exits, or
+ * earlier when that thread next calls local() on a manager it has not used
+ * yet. Until then the handle keeps the shared state alive (one 64-byte slot
+ * per possible thread) along with anything it retired but has not freed.
+ * Long-lived threads that work on many short-lived structures should hold a
+ * Handle from registerThread() instead, since it is released when dropped.
+ */
+class EpochManager {
+public:
+    static constexpr size_t MAX_THREADS = 256;   // Concurrent participants
+    static constexpr size_t COLLECT_THRESHOLD = 64;  // Retires between collections
+
+private:
+    /**
+     * Object waiting to be freed
+     */
+    struct Retired {
+        void* object;
+        void (*deleter)(void*);
+        uint64_t epoch;
+    };
+
+    /**
+     * Per-thread participant record (one cache line each, no false sharing)
+     */
+    struct alignas(64) Slot {
+        std::atomic<uint64_t> epoch{0};   // 0 = quiescent, otherwise pinned epoch
+        std::atomic<bool> inUse{false};   // Claimed by a Handle
+        size_t pinDepth = 0;              // Nested pins (owner thread only)
+        std::vector<Retired> retired;     // Retire list (owner thread only)
+    };
+
+    /**
+     * Shared state, owned jointly by the manager and every live handle
+     */
+    struct State {
+        std::atomic<uint64_t> globalEpoch{1};
+        Slot slots[MAX_THREADS];
+        std::mutex orphanMutex;
+        std::vector<Retired> orphans;     // Left behind by released handles
+
+        ~State() {
+            // No handle references the state any more, so nothing is pinned
+            for (auto& slot : slots) {
+                for (auto& item : slot.retired) item.deleter(item.object);
+            }
+            for (auto& item : orphans) item.deleter(item.object);
+        }
+
+        /**
+         * Smallest epoch any pinned participant may be reading, UINT64_MAX if none
+         */
+        uint64_t minActiveEpoch() const {
+            uint64_t minimum = UINT64_MAX;
+            for (const auto& slot : slots) {
+                uint64_t e = slot.epoch.load(std::memory_order_seq_cst);
+                if (e != 0 && e < minimum) minimum = e;
+            }
+            return minimum;
+        }
+    };
+
+    std::shared_ptr<State> state;
+
+public:
+    /**
+     * RAII pin: the calling thread may dereference shared objects while it lives
+     */
+    class Guard {
+    private:
+        Slot* slot;
+
+    public:
+        explicit Guard(Slot* s) : slot(s) {}
+        Guard(Guard&& other) noexcept : slot(other.slot) { other.slot = nullptr; }
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+        Guard& operator=(Guard&&) = delete;
+
+        ~Guard() {
+            if (slot != nullptr && --slot->pinDepth == 0) {
+                slot->epoch.store(0, std::memory_order_release);
+            }
+        }
+    };
+
+    /**
+     * A thread's membership in the manager; use from one thread at a time
+     */
+    class Handle {
+    private:
+        std::shared_ptr<State> state;
+        Slot* slot;
+
+    public:
+        Handle(std::shared_ptr<State> st, Slot* s) : state(std::move(st)), slot(s) {}
+        Handle(Handle&& other) noexcept : state(std::move(other.state)), slot(other.slot) {
+            other.slot = nullptr;
+        }
+        Handle(const Handle&) = delete;
+        Handle& operator=(const Handle&) = delete;
+        Handle& operator=(Handle&&) = delete;
+
+        /**
+         * Destructor - hand remaining retired objects to the shared orphan list
+         */
+        ~Handle() {
+            if (slot == nullptr) return;
+            if (!slot->retired.empty()) {
+                std::lock_guard<std::mutex> lock(state->orphanMutex);
+                state->orphans.insert(state->orphans.end(), slot->retired.begin(), slot->retired.end());
+                slot->retired.clear();
+            }
+            slot->epoch.store(0, std::memory_order_release);
+            slot->pinDepth = 0;
+            slot->inUse.store(false, std::memory_order_release);
+        }
+
+        /**
+         * Enter a read-side critical section (wait-free; may nest)
+         */
+        Guard pin() {
+            if (slot->pinDepth++ == 0) {
+                // seq_cst store orders the announcement before every later
+                // load of shared pointers (pairs with collect's slot scan)
+                slot->epoch.store(state->globalEpoch.load(std::memory_order_seq_cst),
+                                  std::memory_order_seq_cst);
+            }
+            return Guard(slot);
+        }
+
+        /**
+         * Schedule an already-unlinked object for deletion
+         * @param object Object that no new reader can reach
+         */
+        template <typename U>
+        void retire(U* object) {
+            retire(object, [](void* p) { delete static_cast<U*>(p); });
+        }
+
+        /**
+         * Schedule an already-unlinked object for deletion with a custom deleter
+         */
+        void retire(void* object, void (*deleter)(void*)) {
+            uint64_t epoch = state->globalEpoch.fetch_add(1, std::memory_order_seq_cst);
+            slot->retired.push_back({object, deleter, epoch});
+            if (slot->retired.size() >= COLLECT_THRESHOLD) {
+                collect();
+            }
+        }
+
+        /**
+         * Free every retired object no pinned reader can still reach
+         */
+        void collect() {
+            uint64_t safeBelow = state->minActiveEpoch();
+            freeOlderThan(slot->retired, safeBelow);
+
+            std::unique_lock<std::mutex> lock(state->orphanMutex, std::try_to_lock);
+            if (lock.owns_lock()) {
+                freeOlderThan(state->orphans, safeBelow);
+            }
+        }
+
+        /**
+         * Get number of objects retired by this handle and not yet freed
+         */
+        size_t pendingCount() const {
+            return slot->retired.size();
+        }
+
+    private:
+        static void freeOlderThan(std::vector<Retired>& items, uint64_t safeBelow) {
+            size_t kept = 0;
+            for (auto& item : items) {
+                if (item.epoch < safeBelow) {
+                    item.deleter(item.object);
+                } else {
+                    items[kept++] = item;
+                }
+            }
+            items.resize(kept);
+        }
+    };
+
+    /**
+     * Constructor - Initialize manager with no participants
+     */
+    EpochManager() : state(std::make_shared<State>()) {}
+
+    EpochManager(const EpochManager&) = delete;
+    EpochManager& operator=(const EpochManager&) = delete;
+
+    /**
+     * Claim a participant slot for the calling thread
+     * @return Handle owning the slot until it is destroyed
+     * @throws std::runtime_error if MAX_THREADS handles are already live
+     */
+    Handle registerThread() {
+        for (auto& slot : state->slots) {
+            bool expected = false;
+            if (!slot.inUse.load(std::memory_order_relaxed) &&
+                slot.inUse.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                return Handle(state, &slot);
+            }
+        }
+        throw std::runtime_error("Too many threads registered with EpochManager");
+    }
+
+    /**
+     * Handle of the calling thread, registered on first use
+     * Released at thread exit, or after this manager is destroyed when the
+     * thread first calls local() on another manager
+     */
+    Handle& local() {
+        struct Entry {
+            std::shared_ptr<State> owner;
+            std::unique_ptr<Handle> handle;
+        };
+        thread_local std::vector<Entry> registry;
+
+        for (auto& entry : registry) {
+            if (entry.owner == state) return *entry.handle;
+        }
+
+        // Drop handles of managers that have since been destroyed
+        for (size_t i = registry.size(); i > 0; --i) {
+            if (registry[i - 1].owner.use_count() <= 2) {
+                registry.erase(registry.begin() + (i - 1));
+            }
+        }
+
+        registry.push_back({state, std::make_unique<Handle>(registerThread())});
+        return *registry.back().handle;
+    }
+};
+
+#endif // EPOCH_MANAGER_H
@@ -0,0 +1,482 @@
+#ifndef INTRUSIVE_LIST_H
+#define INTRUSIVE_LIST_H
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <iostream>
+#include <stdexcept>
+
+/**
+ * Intrusive Doubly Linked List Implementation in C++
+ *
+ * Time Complexity:
+ * - Insert at head / tail / before iterator: O(1)
+ * - Delete at head / tail / iterator: O(1)
+ * - Remove a given object: O(1) - no search, the object carries its links
+ * - Iteration (begin to end): O(n)
+ *
+ * Space Complexity: O(1) beyond the objects themselves (two pointers per hook)
+ *
+ * The list never allocates and never copies or owns elements. Each object
+ * embeds an IntrusiveListHook, either by deriving from it or by holding it
+ * as a member, and the list links those hooks in a circle through a
+ * sentinel. Objects must stay in place and outlive their membership: remove
+ * an object before destroying or moving it. One hook can be in one list at
+ * a time; give an object several member hooks to put it in several lists.
+ *
+ * Debug builds (NDEBUG not defined) check on every link and unlink that a
+ * hook is not linked twice, is not unlinked while free, and that its
+ * neighbours point back at it (safe-unlink). remove() also checks that
+ * the object belongs to this list, which costs O(n) in debug builds only.
+ * A hook destroyed while still linked also triggers an assertion.
+ *
+ *     struct Timer : IntrusiveListHook { int deadline; };
+ *     IntrusiveList<Timer> timers;
+ *
+ *     struct Conn { IntrusiveListHook idle; int fd; };
+ *     IntrusiveList<Conn, IntrusiveMemberHook<Conn, &Conn::idle>> idleConns;
+ */
+
+/**
+ * Links embedded in a user object
+ * Copying an object does not copy its membership
+ */
+class IntrusiveListHook {
+private:
+    template <typename, typename> friend class IntrusiveList;
+
+    IntrusiveListHook* prev;
+    IntrusiveListHook* next;
+
+public:
+    IntrusiveListHook() : prev(nullptr), next(nullptr) {}
+    IntrusiveListHook(const IntrusiveListHook&) : prev(nullptr), next(nullptr) {}
+    IntrusiveListHook& operator=(const IntrusiveListHook&) {
+        return *this;
+    }
+
+    ~IntrusiveListHook() {
+        assert(!isLinked() && "object destroyed while still in an IntrusiveList");
+    }
+
+    /**
+     * Check if the hook is currently in a list
+     */
+    bool isLinked() const {
+        return next != nullptr;
+    }
+};
+
+/**
+ * Hook accessor for types deriving from IntrusiveListHook
+ */
+template <typename T>
+struct IntrusiveBaseHook {
+    static IntrusiveListHook* toHook(T* object) {
+        return static_cast<IntrusiveListHook*>(object);
+    }
+
+    static T* toObject(IntrusiveListHook* hook) {
+        return static_cast<T*>(hook);
+    }
+};
+
+/**
+ * Hook accessor for an IntrusiveListHook data member
+ * T must be standard-layout so the member's offset is the same in every
+ * object (derive from IntrusiveListHook otherwise)
+ */
+template <typename T, IntrusiveListHook T::*Member>
+struct IntrusiveMemberHook {
+    static_assert(std::is_standard_layout<T>::value,
+                  "IntrusiveMemberHook needs a standard-layout type; use IntrusiveBaseHook instead");
+
+    static IntrusiveListHook* toHook(T* object) {
+        return &(object->*Member);
+    }
+
+    static T* toObject(IntrusiveListHook* hook) {
+        return reinterpret_cast<T*>(reinterpret_cast<char*>(hook) - offset());
+    }
+
+private:
+    /**
+     * Byte offset of the hook inside T (computed once; fixed for standard-layout T)
+     */
+    static std::ptrdiff_t offset() {
+        static const std::ptrdiff_t value = [] {
+            alignas(T) static char storage[sizeof(T)];
+            T* object = reinterpret_cast<T*>(storage);
+            return reinterpret_cast<char*>(&(object->*Member)) - storage;
+        }();
+        return value;
+    }
+};
+
+template <typename T, typename Hook = IntrusiveBaseHook<T>>
+class IntrusiveList {
+private:
+    IntrusiveListHook root;     // Sentinel: root.next is the head, root.prev the tail
+    size_t size;                // Current number of elements
+
+public:
+    /**
+     * Bidirectional iterator over the linked objects
+     * IsConst selects between iterator and const_iterator
+     */
+    template <bool IsConst>
+    class Iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+
+        Iterator() : hook(nullptr) {}
+
+        template <bool WasConst, typename = std::enable_if_t<IsConst && !WasConst>>
+        Iterator(const Iterator<WasConst>& other) : hook(other.hook) {}
+
+        reference operator*() const {
+            return *Hook::toObject(hook);
+        }
+
+        pointer operator->() const {
+            return Hook::toObject(hook);
+        }
+
+        Iterator& operator++() {
+            hook = hook->next;
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator old = *this;
+            hook = hook->next;
+            return old;
+        }
+
+        Iterator& operator--() {
+            hook = hook->prev;
+            return *this;
+        }
+
+        Iterator operator--(int) {
+            Iterator old = *this;
+            hook = hook->prev;
+            return old;
+        }
+
+        friend bool operator==(const Iterator& a, const Iterator& b) {
+            return a.hook == b.hook;
+        }
+
+        friend bool operator!=(const Iterator& a, const Iterator& b) {
+            return a.hook != b.hook;
+        }
+
+    private:
+        friend class IntrusiveList;
+
+        IntrusiveListHook* hook;
+
+        explicit Iterator(IntrusiveListHook* h) : hook(h) {}
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    /**
+     * Constructor - Initialize empty list
+     */
+    IntrusiveList() : size(0) {
+        root.prev = root.next = &root;
+    }
+
+    IntrusiveList(const IntrusiveList&) = delete;
+    IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+    /**
+     * Move constructor - Takes over the linked objects in O(1)
+     */
+    IntrusiveList(IntrusiveList&& other) noexcept : size(0) {
+        root.prev = root.next = &root;
+        takeFrom(other);
+    }
+
+    /**
+     * Move assignment operator - Unlinks current objects, then takes over other's
+     */
+    IntrusiveList& operator=(IntrusiveList&& other) noexcept {
+        if (this != &other) {
+            clear();
+            takeFrom(other);
+        }
+        return *this;
+    }
+
+    /**
+     * Destructor - Unlink every object (objects themselves are untouched)
+     */
+    ~IntrusiveList() {
+        clear();
+        root.prev = root.next = nullptr;
+    }
+
+    /**
+     * Link object at the front of the list
+     */
+    void pushFront(T& object) {
+        linkBefore(root.next, Hook::toHook(&object));
+    }
+
+    /**
+     * Link object at the back of the list
+     */
+    void pushBack(T& object) {
+        linkBefore(&root, Hook::toHook(&object));
+    }
+
+    /**
+     * Link object before pos
+     * @return Iterator to the object
+     */
+    iterator insert(const_iterator pos, T& object) {
+        IntrusiveListHook* hook = Hook::toHook(&object);
+        linkBefore(pos.hook, hook);
+        return iterator(hook);
+    }
+
+    /**
+     * Unlink the first object
+     * @return The unlinked object
+     * @throws std::underflow_error if list is empty
+     */
+    T& popFront() {
+        if (isEmpty()) {
+            throw std::underflow_error("List is empty");
+        }
+        IntrusiveListHook* hook = root.next;
+        unlink(hook);
+        return *Hook::toObject(hook);
+    }
+
+    /**
+     * Unlink the last object
+     * @return The unlinked object
+     * @throws std::underflow_error if list is empty
+     */
+    T& popBack() {
+        if (isEmpty()) {
+            throw std::underflow_error("List is empty");
+        }
+        IntrusiveListHook* hook = root.prev;
+        unlink(hook);
+        return *Hook::toObject(hook);
+    }
+
+    /**
+     * Unlink the object at pos
+     * @return Iterator to the following object
+     * @throws std::out_of_range if pos is end()
+     */
+    iterator erase(const_iterator pos) {
+        if (pos.hook == &root) {
+            throw std::out_of_range("Iterator out of range");
+        }
+        IntrusiveListHook* next = pos.hook->next;
+        unlink(pos.hook);
+        return iterator(next);
+    }
+
+    /**
+     * Unlink a given object of this list in O(1)
+     * Debug builds walk the ring to check that object is in this list, O(n)
+     * @param object Object currently linked into this list
+     */
+    void remove(T& object) {
+        IntrusiveListHook* hook = Hook::toHook(&object);
+        assert(owns(hook) && "object is not in this list");
+        unlink(hook);
+    }
+
+    /**
+     * Iterator to an object known to be in this list, in O(1)
+     */
+    iterator iteratorTo(T& object) {
+        return iterator(Hook::toHook(&object));
+    }
+
+    const_iterator iteratorTo(const T& object) const {
+        return const_iterator(Hook::toHook(const_cast<T*>(&object)));
+    }
+
+    /**
+     * Check whether object is linked into some list using this hook
+     */
+    static bool isLinked(const T& object) {
+        return Hook::toHook(const_cast<T*>(&object))->isLinked();
+    }
+
+    /**
+     * Get first object
+     * @throws std::underflow_error if list is empty
+     */
+    T& front() {
+        if (isEmpty()) {
+            throw std::underflow_error("List is empty");
+        }
+        return *Hook::toObject(root.next);
+    }
+
+    const T& front() const {
+        if (isEmpty()) {
+            throw std::underflow_error("List is empty");
+        }
+        return *Hook::toObject(root.next);
+    }
+
+    /**
+     * Get last object
+     * @throws std::underflow_error if list is empty
+     */
+    T& back() {
+        if (isEmpty()) {
+            throw std::underflow_error("List is empty");
+        }
+        return *Hook::toObject(root.prev);
+    }
+
+    const T& back() const {
+        if (isEmpty()) {
+            throw std::underflow_error("List is empty");
+        }
+        return *Hook::toObject(root.prev);
+    }
+
+    /**
+     * Check if list is empty
+     */
+    bool isEmpty() const {
+        return size == 0;
+    }
+
+    /**
+     * Get current size of list
+     */
+    size_t getSize() const {
+        return size;
+    }
+
+    /**
+     * Unlink every object (objects themselves are untouched)
+     */
+    void clear() {
+        IntrusiveListHook* current = root.next;
+        while (current != &root) {
+            IntrusiveListHook* next = current->next;
+            current->prev = current->next = nullptr;
+            current = next;
+        }
+        root.prev = root.next = &root;
+        size = 0;
+    }
+
+    /**
+     * Display list contents (for debugging; needs operator<< for T)
+     */
+    void display() const {
+        if (isEmpty()) {
+            std::cout << "List is empty" << std::endl;
+            return;
+        }
+
+        std::cout << "List: ";
+        for (const_iterator it = begin(); it != end(); ++it) {
+            std::cout << *it;
+            if (it.hook->next != &root) {
+                std::cout << " <-> ";
+            }
+        }
+        std::cout << " (size: " << size << ")" << std::endl;
+    }
+
+    iterator begin() {
+        return iterator(root.next);
+    }
+
+    iterator end() {
+        return iterator(&root);
+    }
+
+    const_iterator begin() const {
+        return const_iterator(root.next);
+    }
+
+    const_iterator end() const {
+        return const_iterator(const_cast<IntrusiveListHook*>(&root));
+    }
+
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    const_iterator cend() const {
+        return end();
+    }
+
+private:
+    void linkBefore(IntrusiveListHook* position, IntrusiveListHook* hook) {
+        assert(!hook->isLinked() && "object is already in a list");
+        hook->next = position;
+        hook->prev = position->prev;
+        position->prev->next = hook;
+        position->prev = hook;
+        size++;
+    }
+
+    /**
+     * Check that hook is in this list by walking its ring back to root
+     */
+    bool owns(const IntrusiveListHook* hook) const {
+        if (!hook->isLinked()) {
+            return false;
+        }
+        for (const IntrusiveListHook* current = hook->next; current != hook; current = current->next) {
+            if (current == &root) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void unlink(IntrusiveListHook* hook) {
+        assert(hook->isLinked() && "object is not in a list");
+        assert(hook->prev->next == hook && hook->next->prev == hook && "corrupted links (safe-unlink check)");
+        hook->prev->next = hook->next;
+        hook->next->prev = hook->prev;
+        hook->prev = hook->next = nullptr;
+        size--;
+    }
+
+    /**
+     * Take over other's chain by repointing its ends at this sentinel
+     */
+    void takeFrom(IntrusiveList& other) {
+        if (other.isEmpty()) {
+            return;
+        }
+        root.next = other.root.next;
+        root.prev = other.root.prev;
+        root.next->prev = &root;
+        root.prev->next = &root;
+        size = other.size;
+        other.root.prev = other.root.next = &other.root;
+        other.size = 0;
+    }
+};
+
+#endif // INTRUSIVE_LIST_H
@@ -0,0 +1,287 @@
+#ifndef KD_TREE_H
+#define KD_TREE_H
+
+#include <array>
+#include <vector>
+#include <queue>
+#include <thread>
+#include <future>
+#include <utility>
+#include <numeric>
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * Static Implicit k-d Tree
+ *
+ * Time Complexity:
+ * - Build: O(n log n) - median selection at every level
+ * - Box query: O(n^(1-1/D) + m) where m is the number of reported points
+ * - k nearest neighbours: O(log n + k log k) expected
+ * - Batched queries: the above per query, spread over worker threads
+ *
+ * Space Complexity: O(n) - no child pointers are stored
+ *
+ * The tree is a complete binary tree stored in BFS (Eytzinger) order in a
+ * single array: the root is slot 1 and the children of slot i are 2i and
+ * 2i + 1. Building it is recursive median partitioning (quickselect, as in
+ * QuickSort), alternating the split axis by depth; each range is split so
+ * that its left part has exactly the size of a complete left subtree, which
+ * keeps the slots dense. The top levels every query passes through sit
+ * together at the front of the array, so the first few steps of a descent
+ * share a handful of cache lines.
+ */
+template <typename T, size_t D = 2>
+class StaticKDTree {
+public:
+    using Point = std::array<T, D>;
+
+private:
+    static constexpr size_t PARALLEL_CUTOFF = 4096;  // Smaller ranges build serially
+
+    std::vector<Point> points;   // Points in BFS order, 1-based (slot 0 unused)
+    std::vector<size_t> ids;     // ids[i] = index of points[i] in the input
+
+public:
+    /**
+     * Constructor - Initialize empty tree
+     */
+    StaticKDTree() = default;
+
+    /**
+     * Constructor - Build tree from points
+     * @param input Points to index (query results refer to their indices)
+     * @param threads Number of threads used for building (1 = serial)
+     */
+    explicit StaticKDTree(const std::vector<Point>& input, unsigned threads = 1) {
+        build(input, threads);
+    }
+
+    /**
+     * Rebuild tree from points
+     * @param input Points to index (query results refer to their indices)
+     * @param threads Number of threads used for building (1 = serial)
+     */
+    void build(const std::vector<Point>& input, unsigned threads = 1) {
+        points.assign(input.size() + 1, Point());
+        ids.assign(input.size() + 1, 0);
+
+        std::vector<size_t> order(input.size());
+        std::iota(order.begin(), order.end(), 0);
+        buildRange(input, order, 0, order.size(), 1, 0, threads < 1 ? 1 : threads);
+    }
+
+    /**
+     * Find all points inside an axis-aligned box (bounds inclusive)
+     * @param lo Lower corner of the box
+     * @param hi Upper corner of the box
+     * @return Input indices of the points inside the box
+     */
+    std::vector<size_t> boxQuery(const Point& lo, const Point& hi) const {
+        std::vector<size_t> result;
+
+        // Explicit stack of (slot, axis) pairs, as in quickSortIterative
+        std::vector<std::pair<size_t, size_t>> stack;
+        stack.push_back({1, 0});
+
+        while (!stack.empty()) {
+            auto [slot, axis] = stack.back();
+            stack.pop_back();
+            if (slot >= points.size()) continue;
+
+            const Point& p = points[slot];
+
+            if (inBox(p, lo, hi)) {
+                result.push_back(ids[slot]);
+            }
+
+            size_t nextAxis = (axis + 1) % D;
+            if (!(p[axis] < lo[axis])) stack.push_back({2 * slot, nextAxis});
+            if (!(hi[axis] < p[axis])) stack.push_back({2 * slot + 1, nextAxis});
+        }
+
+        return result;
+    }
+
+    /**
+     * Find the k points nearest to a query point (squared Euclidean distance)
+     * @param query Query point
+     * @param k Number of neighbours to return
+     * @return Input indices ordered from nearest to farthest
+     */
+    std::vector<size_t> nearest(const Point& query, size_t k) const {
+        std::priority_queue<std::pair<double, size_t>> best;  // Max-heap of (distance, slot)
+        if (k > 0) {
+            nearestRange(query, k, 1, 0, best);
+        }
+
+        std::vector<size_t> result(best.size());
+        for (size_t i = result.size(); i > 0; --i) {
+            result[i - 1] = ids[best.top().second];
+            best.pop();
+        }
+        return result;
+    }
+
+    /**
+     * Answer many box queries, spread over worker threads
+     * @param boxes Pairs of (lower corner, upper corner)
+     * @param threads Number of worker threads
+     * @return One result list per box, in the same order
+     */
+    std::vector<std::vector<size_t>> boxQueryBatch(const std::vector<std::pair<Point, Point>>& boxes,
+                                                   unsigned threads = 1) const {
+        std::vector<std::vector<size_t>> results(boxes.size());
+        parallelFor(boxes.size(), threads, [&](size_t i) {
+            results[i] = boxQuery(boxes[i].first, boxes[i].second);
+        });
+        return results;
+    }
+
+    /**
+     * Answer many k-nearest-neighbour queries, spread over worker threads
+     * @param queries Query points
+     * @param k Number of neighbours per query
+     * @param threads Number of worker threads
+     * @return One result list per query, in the same order
+     */
+    std::vector<std::vector<size_t>> nearestBatch(const std::vector<Point>& queries, size_t k,
+                                                  unsigned threads = 1) const {
+        std::vector<std::vector<size_t>> results(queries.size());
+        parallelFor(queries.size(), threads, [&](size_t i) {
+            results[i] = nearest(queries[i], k);
+        });
+        return results;
+    }
+
+    /**
+     * Get number of indexed points
+     */
+    size_t getSize() const {
+        return points.empty() ? 0 : points.size() - 1;
+    }
+
+    /**
+     * Check if tree is empty
+     */
+    bool isEmpty() const {
+        return getSize() == 0;
+    }
+
+private:
+    /**
+     * Size of the left subtree of a complete binary tree with n nodes
+     */
+    static size_t leftSubtreeSize(size_t n) {
+        size_t full = 1;  // Nodes on the deepest full level
+        while (2 * full <= n) full *= 2;
+        if (full == 1) return 0;
+        size_t half = full / 2;
+        size_t lastLevel = n - (full - 1);
+        return (half - 1) + std::min(lastLevel, half);
+    }
+
+    /**
+     * Recursive median partitioning of order[begin, end) on the given axis;
+     * the median goes to slot and the two parts become its subtrees
+     */
+    void buildRange(const std::vector<Point>& input, std::vector<size_t>& order, size_t begin,
+                    size_t end, size_t slot, size_t axis, unsigned threads) {
+        if (begin >= end) return;
+
+        size_t mid = begin + leftSubtreeSize(end - begin);
+        std::nth_element(order.begin() + begin, order.begin() + mid, order.begin() + end,
+                         [&](size_t a, size_t b) { return input[a][axis] < input[b][axis]; });
+        points[slot] = input[order[mid]];
+        ids[slot] = order[mid];
+
+        size_t nextAxis = (axis + 1) % D;
+        if (threads > 1 && end - begin >= PARALLEL_CUTOFF) {
+            // Subtrees are disjoint ranges and slots, so they can be built concurrently
+            unsigned leftThreads = threads / 2;
+            auto left = std::async(std::launch::async, [&, leftThreads] {
+                buildRange(input, order, begin, mid, 2 * slot, nextAxis, leftThreads);
+            });
+            buildRange(input, order, mid + 1, end, 2 * slot + 1, nextAxis, threads - leftThreads);
+            left.get();
+        } else {
+            buildRange(input, order, begin, mid, 2 * slot, nextAxis, 1);
+            buildRange(input, order, mid + 1, end, 2 * slot + 1, nextAxis, 1);
+        }
+    }
+
+    void nearestRange(const Point& query, size_t k, size_t slot, size_t axis,
+                      std::priority_queue<std::pair<double, size_t>>& best) const {
+        if (slot >= points.size()) return;
+
+        const Point& p = points[slot];
+
+        double dist = squaredDistance(p, query);
+        if (best.size() < k) {
+            best.push({dist, slot});
+        } else if (dist < best.top().first) {
+            best.pop();
+            best.push({dist, slot});
+        }
+
+        double diff = static_cast<double>(query[axis]) - static_cast<double>(p[axis]);
+        size_t nextAxis = (axis + 1) % D;
+
+        // Visit the side containing the query first; the other side only
+        // matters if the splitting plane is closer than the current k-th best
+        if (diff < 0) {
+            nearestRange(query, k, 2 * slot, nextAxis, best);
+            if (best.size() < k || diff * diff < best.top().first) {
+                nearestRange(query, k, 2 * slot + 1, nextAxis, best);
+            }
+        } else {
+            nearestRange(query, k, 2 * slot + 1, nextAxis, best);
+            if (best.size() < k || diff * diff < best.top().first) {
+                nearestRange(query, k, 2 * slot, nextAxis, best);
+            }
+        }
+    }
+
+    static bool inBox(const Point& p, const Point& lo, const Point& hi) {
+        for (size_t d = 0; d < D; ++d) {
+            if (p[d] < lo[d] || hi[d] < p[d]) return false;
+        }
+        return true;
+    }
+
+    static double squaredDistance(const Point& a, const Point& b) {
+        double sum = 0;
+        for (size_t d = 0; d < D; ++d) {
+            double diff = static_cast<double>(a[d]) - static_cast<double>(b[d]);
+            sum += diff * diff;
+        }
+        return sum;
+    }
+
+    /**
+     * Run body(i) for i in [0, count), splitting the range over threads
+     */
+    template <typename Body>
+    static void parallelFor(size_t count, unsigned threads, Body body) {
+        if (threads <= 1 || count < 2) {
+            for (size_t i = 0; i < count; ++i) body(i);
+            return;
+        }
+
+        size_t workers = std::min<size_t>(threads, count);
+        size_t chunk = (count + workers - 1) / workers;
+        std::vector<std::thread> pool;
+        for (size_t w = 0; w < workers; ++w) {
+            size_t first = w * chunk;
+            size_t last = std::min(count, first + chunk);
+            pool.emplace_back([=, &body] {
+                for (size_t i = first; i < last; ++i) body(i);
+            });
+        }
+        for (auto& worker : pool) {
+            worker.join();
+        }
+    }
+};
+
+#endif // KD_TREE_H
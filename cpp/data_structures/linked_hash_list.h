@@ -0,0 +1,552 @@
+#ifndef LINKED_HASH_LIST_H
+#define LINKED_HASH_LIST_H
+
+#include <new>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <iterator>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <initializer_list>
+#include "node_pool.h"
+
+/**
+ * Linked Hash List (insertion-ordered set) Implementation in C++
+ *
+ * Time Complexity (expected):
+ * - Insert at head / tail: O(1)
+ * - Contains / find by value: O(1)
+ * - Remove by value / at iterator: O(1)
+ * - Move to front / back: O(1)
+ * - Delete at head / tail: O(1)
+ * - Iteration (either direction): O(n)
+ *
+ * Space Complexity: O(n) - one pooled node per element plus an index of
+ * at most 4/3 * n slots rounded up to a power of two
+ *
+ * Elements are unique and live in a doubly linked list that fixes their
+ * order, so iteration sees insertion order (or the order set by
+ * moveToFront / moveToBack). A separate open-addressing index maps each
+ * value to its node. It probes linearly and deletes by backward shift, so
+ * it never builds up tombstones. Nodes cache their hash, so growing the
+ * index never rehashes a value. With moveToFront and popBack this is the
+ * core of an LRU cache.
+ */
+template <typename T, typename Hash = std::hash<T>, typename KeyEqual = std::equal_to<T>>
+class LinkedHashList {
+private:
+    /**
+     * Node structure for the ordering list
+     */
+    struct Node {
+        T data;
+        size_t hash;
+        Node* prev;
+        Node* next;
+
+        Node(const T& value, size_t h) : data(value), hash(h), prev(nullptr), next(nullptr) {}
+    };
+
+    static constexpr size_t MIN_CAPACITY = 16;
+
+    Node* head;                 // First element in order
+    Node* tail;                 // Last element in order
+    size_t size;                // Current number of elements
+    std::vector<Node*> index;   // Open-addressing table (nullptr = empty slot)
+    Hash hasher;
+    KeyEqual equal;
+    NodePool pool;              // Source of node memory
+
+public:
+    /**
+     * Bidirectional iterator over elements in list order (read-only:
+     * changing a value in place would desynchronize the index)
+     */
+    class Iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        Iterator() : node(nullptr), list(nullptr) {}
+
+        reference operator*() const {
+            return node->data;
+        }
+
+        pointer operator->() const {
+            return &node->data;
+        }
+
+        Iterator& operator++() {
+            node = node->next;
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator old = *this;
+            node = node->next;
+            return old;
+        }
+
+        /**
+         * Decrementing end() yields the last element
+         */
+        Iterator& operator--() {
+            node = node == nullptr ? list->tail : node->prev;
+            return *this;
+        }
+
+        Iterator operator--(int) {
+            Iterator old = *this;
+            --*this;
+            return old;
+        }
+
+        friend bool operator==(const Iterator& a, const Iterator& b) {
+            return a.node == b.node;
+        }
+
+        friend bool operator!=(const Iterator& a, const Iterator& b) {
+            return a.node != b.node;
+        }
+
+    private:
+        friend class LinkedHashList;
+
+        Node* node;
+        const LinkedHashList* list;
+
+        Iterator(Node* n, const LinkedHashList* l) : node(n), list(l) {}
+    };
+
+    using iterator = Iterator;
+    using const_iterator = Iterator;
+
+    /**
+     * Constructor - Initialize empty list
+     */
+    explicit LinkedHashList(const Hash& hash = Hash(), const KeyEqual& keyEqual = KeyEqual())
+        : head(nullptr), tail(nullptr), size(0), hasher(hash), equal(keyEqual),
+          pool(sizeof(Node), alignof(Node)) {}
+
+    /**
+     * Constructor with initializer list (later duplicates are ignored)
+     */
+    LinkedHashList(std::initializer_list<T> init) : LinkedHashList() {
+        reserve(init.size());
+        for (const auto& item : init) {
+            pushBack(item);
+        }
+    }
+
+    /**
+     * Copy constructor
+     */
+    LinkedHashList(const LinkedHashList& other) : LinkedHashList(other.hasher, other.equal) {
+        copyFrom(other);
+    }
+
+    /**
+     * Assignment operator
+     */
+    LinkedHashList& operator=(const LinkedHashList& other) {
+        if (this != &other) {
+            clear();
+            copyFrom(other);
+        }
+        return *this;
+    }
+
+    /**
+     * Destructor - Clean up all nodes
+     */
+    ~LinkedHashList() {
+        clear();
+    }
+
+    /**
+     * Add value at the back if it is not present yet
+     * @return true if inserted, false if already present (its position is kept)
+     */
+    bool pushBack(const T& value) {
+        return insertBefore(nullptr, value);
+    }
+
+    /**
+     * Add value at the front if it is not present yet
+     * @return true if inserted, false if already present (its position is kept)
+     */
+    bool pushFront(const T& value) {
+        return insertBefore(head, value);
+    }
+
+    /**
+     * Same as pushBack (set-style name)
+     */
+    bool insert(const T& value) {
+        return pushBack(value);
+    }
+
+    /**
+     * Remove value
+     * @return true if element was found and removed, false otherwise
+     */
+    bool remove(const T& value) {
+        size_t slot;
+        if (!locate(value, hashOf(value), slot)) {
+            return false;
+        }
+        eraseNode(index[slot], slot);
+        return true;
+    }
+
+    /**
+     * Remove element at pos
+     * @return Iterator to the following element
+     * @throws std::out_of_range if pos is end()
+     */
+    iterator erase(const_iterator pos) {
+        if (pos.node == nullptr) {
+            throw std::out_of_range("Iterator out of range");
+        }
+        Node* next = pos.node->next;
+        eraseNode(pos.node, slotOf(pos.node));
+        return iterator(next, this);
+    }
+
+    /**
+     * Remove element from the front of the list
+     * @throws std::underflow_error if list is empty
+     */
+    T popFront() {
+        if (isEmpty()) {
+            throw std::underflow_error("List is empty");
+        }
+        T value = head->data;
+        eraseNode(head, slotOf(head));
+        return value;
+    }
+
+    /**
+     * Remove element from the back of the list (the LRU victim)
+     * @throws std::underflow_error if list is empty
+     */
+    T popBack() {
+        if (isEmpty()) {
+            throw std::underflow_error("List is empty");
+        }
+        T value = tail->data;
+        eraseNode(tail, slotOf(tail));
+        return value;
+    }
+
+    /**
+     * Iterator to value, or end() if it is not present
+     */
+    iterator find(const T& value) const {
+        size_t slot;
+        if (!locate(value, hashOf(value), slot)) {
+            return end();
+        }
+        return iterator(index[slot], this);
+    }
+
+    /**
+     * Check if value exists in the list
+     */
+    bool contains(const T& value) const {
+        size_t slot;
+        return locate(value, hashOf(value), slot);
+    }
+
+    /**
+     * Move an existing value to the front (mark as most recently used)
+     * @return false if value is not present
+     */
+    bool moveToFront(const T& value) {
+        iterator it = find(value);
+        if (it.node == nullptr) {
+            return false;
+        }
+        if (it.node != head) {
+            unlink(it.node);
+            linkBefore(head, it.node);
+        }
+        return true;
+    }
+
+    /**
+     * Move an existing value to the back
+     * @return false if value is not present
+     */
+    bool moveToBack(const T& value) {
+        iterator it = find(value);
+        if (it.node == nullptr) {
+            return false;
+        }
+        if (it.node != tail) {
+            unlink(it.node);
+            linkBefore(nullptr, it.node);
+        }
+        return true;
+    }
+
+    /**
+     * Get first element
+     * @throws std::underflow_error if list is empty
+     */
+    const T& front() const {
+        if (isEmpty()) {
+            throw std::underflow_error("List is empty");
+        }
+        return head->data;
+    }
+
+    /**
+     * Get last element
+     * @throws std::underflow_error if list is empty
+     */
+    const T& back() const {
+        if (isEmpty()) {
+            throw std::underflow_error("List is empty");
+        }
+        return tail->data;
+    }
+
+    /**
+     * Check if list is empty
+     */
+    bool isEmpty() const {
+        return size == 0;
+    }
+
+    /**
+     * Get current size of list
+     */
+    size_t getSize() const {
+        return size;
+    }
+
+    /**
+     * Make room for count elements without growing the index
+     */
+    void reserve(size_t count) {
+        size_t capacity = MIN_CAPACITY;
+        while (capacity * 3 < count * 4) {
+            capacity *= 2;
+        }
+        if (capacity > index.size()) {
+            rehash(capacity);
+        }
+    }
+
+    /**
+     * Clear all elements from list
+     */
+    void clear() {
+        Node* current = head;
+        while (current != nullptr) {
+            Node* next = current->next;
+            current->~Node();
+            current = next;
+        }
+        pool.release();
+        index.clear();
+        head = tail = nullptr;
+        size = 0;
+    }
+
+    /**
+     * Display list contents (for debugging)
+     */
+    void display() const {
+        if (isEmpty()) {
+            std::cout << "List is empty" << std::endl;
+            return;
+        }
+
+        std::cout << "List: ";
+        for (Node* current = head; current != nullptr; current = current->next) {
+            std::cout << current->data;
+            if (current->next != nullptr) {
+                std::cout << " <-> ";
+            }
+        }
+        std::cout << " (size: " << size << ")" << std::endl;
+    }
+
+    iterator begin() const {
+        return iterator(head, this);
+    }
+
+    iterator end() const {
+        return iterator(nullptr, this);
+    }
+
+    iterator cbegin() const {
+        return begin();
+    }
+
+    iterator cend() const {
+        return end();
+    }
+
+private:
+    /**
+     * Hash with a splitmix64 finalizer, so identity hashes of integers
+     * still spread over the low bits used for slot selection
+     */
+    size_t hashOf(const T& value) const {
+        uint64_t x = static_cast<uint64_t>(hasher(value));
+        x ^= x >> 30;
+        x *= 0xBF58476D1CE4E5B9ULL;
+        x ^= x >> 27;
+        x *= 0x94D049BB133111EBULL;
+        x ^= x >> 31;
+        return static_cast<size_t>(x);
+    }
+
+    size_t mask() const {
+        return index.size() - 1;
+    }
+
+    /**
+     * Find the slot holding value, or the empty slot where it would go
+     * @return true if found
+     */
+    bool locate(const T& value, size_t hash, size_t& slot) const {
+        if (index.empty()) {
+            return false;
+        }
+        for (slot = hash & mask(); index[slot] != nullptr; slot = (slot + 1) & mask()) {
+            if (index[slot]->hash == hash && equal(index[slot]->data, value)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Slot of a node known to be in the index
+     */
+    size_t slotOf(Node* node) const {
+        size_t slot = node->hash & mask();
+        while (index[slot] != node) {
+            slot = (slot + 1) & mask();
+        }
+        return slot;
+    }
+
+    bool insertBefore(Node* position, const T& value) {
+        size_t hash = hashOf(value);
+        size_t slot;
+        if (locate(value, hash, slot)) {
+            return false;
+        }
+
+        if ((size + 1) * 4 > index.size() * 3) {
+            rehash(index.empty() ? MIN_CAPACITY : index.size() * 2);
+            locate(value, hash, slot);
+        }
+
+        void* memory = pool.allocate();
+        Node* node;
+        try {
+            node = new (memory) Node(value, hash);
+        } catch (...) {
+            pool.deallocate(memory);
+            throw;
+        }
+
+        index[slot] = node;
+        linkBefore(position, node);
+        size++;
+        return true;
+    }
+
+    /**
+     * Remove node from both the list and the index (slot holds node)
+     */
+    void eraseNode(Node* node, size_t slot) {
+        // Backward-shift deletion keeps every probe chain unbroken
+        size_t hole = slot;
+        for (size_t next = (hole + 1) & mask(); index[next] != nullptr; next = (next + 1) & mask()) {
+            size_t ideal = index[next]->hash & mask();
+            bool staysPut = hole <= next ? (hole < ideal && ideal <= next) : (hole < ideal || ideal <= next);
+            if (!staysPut) {
+                index[hole] = index[next];
+                hole = next;
+            }
+        }
+        index[hole] = nullptr;
+
+        unlink(node);
+        node->~Node();
+        pool.deallocate(node);
+        size--;
+    }
+
+    void rehash(size_t capacity) {
+        std::vector<Node*> table(capacity, nullptr);
+        for (Node* current = head; current != nullptr; current = current->next) {
+            size_t slot = current->hash & (capacity - 1);
+            while (table[slot] != nullptr) {
+                slot = (slot + 1) & (capacity - 1);
+            }
+            table[slot] = current;
+        }
+        index.swap(table);
+    }
+
+    /**
+     * Link node before position (nullptr = at the back)
+     */
+    void linkBefore(Node* position, Node* node) {
+        Node* prev = position != nullptr ? position->prev : tail;
+        node->prev = prev;
+        node->next = position;
+        if (prev != nullptr) {
+            prev->next = node;
+        } else {
+            head = node;
+        }
+        if (position != nullptr) {
+            position->prev = node;
+        } else {
+            tail = node;
+        }
+    }
+
+    void unlink(Node* node) {
+        if (node->prev != nullptr) {
+            node->prev->next = node->next;
+        } else {
+            head = node->next;
+        }
+        if (node->next != nullptr) {
+            node->next->prev = node->prev;
+        } else {
+            tail = node->prev;
+        }
+        node->prev = node->next = nullptr;
+    }
+
+    /**
+     * Helper function to copy from another list
+     */
+    void copyFrom(const LinkedHashList& other) {
+        reserve(other.size);
+        pool.reserve(other.size);
+        for (Node* current = other.head; current != nullptr; current = current->next) {
+            pushBack(current->data);
+        }
+    }
+};
+
+#endif // LINKED_HASH_LIST_H
@@ -1,9 +1,16 @@
 #ifndef LINKED_LIST_H
 #define LINKED_LIST_H
 
+#include <new>
+#include <memory>
+#include <utility>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
 #include <iostream>
 #include <stdexcept>
 #include <initializer_list>
+#include "node_pool.h"
 
 /**
  * Singly Linked List Implementation in C++
@@ -16,9 +23,44 @@
  * - Delete at tail: O(n) without doubly linked
  * - Delete at index: O(n)
  * - Search: O(n)
- * - Access by index: O(n)
+ * - Access by index: O(n), O(distance) when moving forward from the last
+ *   non-const access
+ * - Iteration (begin to end): O(n)
+ * - Insert / erase after iterator: O(1)
+ * - Move construction / assignment: O(1) - nodes are relinked, not copied
+ * - Append / splice after iterator: O(1) when both lists share a pool or
+ *   the donor's pool is used by no other list
+ * - Split at iterator: O(k) where k is the position of the split point
+ * - Clear / destruction: O(n) node destructor calls, O(slabs) when T is
+ *   trivially destructible and the pool is private
+ * - Compact: O(n)
  * 
  * Space Complexity: O(n) where n is the number of elements
+ * 
+ * Nodes come from a NodePool (cache-line-aligned slabs plus a free list)
+ * instead of one new/delete per element. Each list owns a private pool by
+ * default; lists constructed with the same shared pool recycle each
+ * other's nodes and can exchange them by relinking. Splicing from a list
+ * whose pool is private merges that pool into this list's pool, after which
+ * both lists share it, so the nodes are relinked as well. Only when the
+ * donor's pool is also used by other lists is each element moved (O(k)).
+ *
+ * The list remembers the last node reached by index (the finger). at,
+ * operator[], insert and removeAt start from it when the target lies
+ * ahead, so scanning "for i in 0..n: list[i]" costs O(n) in total rather
+ * than O(n^2). Only non-const access moves the finger. Const lookups start
+ * from it but leave it in place, so several threads may read one const
+ * list at the same time, as with any container. For repeated edits at one
+ * place, a Cursor keeps its predecessor node, so insert and erase at the
+ * cursor are O(1).
+ *
+ * After heavy churn, the free list hands out nodes in arbitrary order and
+ * a traversal misses the cache on almost every node. compact() moves the
+ * elements into one fresh block in list order. With setAutoCompact, the
+ * removal operations that return by value (popFront, popBack, removeAt,
+ * remove) trigger compaction themselves. They do this when frees since the
+ * last compaction outnumber the elements and locality() has fallen below
+ * the threshold.
  */
 template <typename T>
 class LinkedList {
@@ -30,35 +72,270 @@ private:
         T data;
         Node* next;
         
-        Node(const T& value) : data(value), next(nullptr) {}
+        template <typename... Args>
+        explicit Node(Args&&... args) : data(std::forward<Args>(args)...), next(nullptr) {}
     };
     
     Node* head;     // Pointer to first node
     Node* tail;     // Pointer to last node
     size_t size;    // Current number of elements
+    std::shared_ptr<NodePool> pool;  // Source of node memory
+    Node* fingerNode;                // Last node reached by index (nullptr = none)
+    size_t fingerIndex;              // Index of fingerNode
+    size_t churn = 0;                // Nodes freed since the last clear / compact
+    double autoCompactThreshold = 0; // Locality below which to compact (0 = never)
+    
+    template <typename It>
+    using RequireInputIterator = std::enable_if_t<std::is_base_of<std::input_iterator_tag,
+        typename std::iterator_traits<It>::iterator_category>::value>;
 
 public:
+    /**
+     * Forward iterator over list elements
+     * IsConst selects between iterator and const_iterator
+     */
+    template <bool IsConst>
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+        
+        Iterator() : node(nullptr) {}
+        
+        /**
+         * Conversion from iterator to const_iterator
+         */
+        template <bool WasConst, typename = std::enable_if_t<IsConst && !WasConst>>
+        Iterator(const Iterator<WasConst>& other) : node(other.node) {}
+        
+        reference operator*() const {
+            return node->data;
+        }
+        
+        pointer operator->() const {
+            return &node->data;
+        }
+        
+        Iterator& operator++() {
+            node = node->next;
+            return *this;
+        }
+        
+        Iterator operator++(int) {
+            Iterator old = *this;
+            node = node->next;
+            return old;
+        }
+        
+        friend bool operator==(const Iterator& a, const Iterator& b) {
+            return a.node == b.node;
+        }
+        
+        friend bool operator!=(const Iterator& a, const Iterator& b) {
+            return a.node != b.node;
+        }
+        
+    private:
+        friend class LinkedList;
+        
+        Node* node;
+        
+        explicit Iterator(Node* n) : node(n) {}
+    };
+    
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    
+    /**
+     * Position in the list for repeated local edits
+     * Keeps the predecessor of the current element, so insert and erase at
+     * the cursor are O(1). Structural changes made through anything other
+     * than this cursor invalidate it.
+     */
+    class Cursor {
+    public:
+        /**
+         * Check whether the cursor is past the last element
+         */
+        bool atEnd() const {
+            return current() == nullptr;
+        }
+        
+        /**
+         * Get index of the current element (size when at the end)
+         */
+        size_t getIndex() const {
+            return index;
+        }
+        
+        /**
+         * Get the current element
+         * @throws std::out_of_range if the cursor is at the end
+         */
+        T& get() const {
+            Node* node = current();
+            if (node == nullptr) {
+                throw std::out_of_range("Cursor out of range");
+            }
+            return node->data;
+        }
+        
+        /**
+         * Move forward
+         * @param steps Number of elements to skip
+         * @throws std::out_of_range if this would move past the end
+         */
+        Cursor& advance(size_t steps = 1) {
+            if (steps > list->size - index) {
+                throw std::out_of_range("Cursor out of range");
+            }
+            for (size_t i = 0; i < steps; ++i) {
+                prev = current();
+            }
+            index += steps;
+            return *this;
+        }
+        
+        /**
+         * Insert element before the current one; the cursor moves onto it
+         */
+        void insert(const T& value) {
+            emplace(value);
+        }
+        
+        void insert(T&& value) {
+            emplace(std::move(value));
+        }
+        
+        /**
+         * Construct element in place before the current one; the cursor moves onto it
+         * @return Reference to the new element
+         */
+        template <typename... Args>
+        T& emplace(Args&&... args) {
+            Node* newNode = list->createNode(std::forward<Args>(args)...);
+            if (prev == nullptr) {
+                newNode->next = list->head;
+                list->head = newNode;
+            } else {
+                newNode->next = prev->next;
+                prev->next = newNode;
+            }
+            if (newNode->next == nullptr) {
+                list->tail = newNode;
+            }
+            list->size++;
+            list->fingerInserted(index);
+            return newNode->data;
+        }
+        
+        /**
+         * Remove the current element; the cursor moves to the following one
+         * @return The removed element
+         * @throws std::out_of_range if the cursor is at the end
+         */
+        T erase() {
+            Node* node = current();
+            if (node == nullptr) {
+                throw std::out_of_range("Cursor out of range");
+            }
+            
+            if (prev == nullptr) {
+                list->head = node->next;
+            } else {
+                prev->next = node->next;
+            }
+            if (node == list->tail) {
+                list->tail = prev;
+            }
+            list->fingerErased(index, node);
+            
+            T value = std::move(node->data);
+            list->destroyNode(node);
+            list->size--;
+            return value;
+        }
+        
+    private:
+        friend class LinkedList;
+        
+        LinkedList* list;
+        Node* prev;     // Node before the current one (nullptr = before head)
+        size_t index;   // Index of the current element
+        
+        Cursor(LinkedList* l, Node* p, size_t i) : list(l), prev(p), index(i) {}
+        
+        Node* current() const {
+            return prev == nullptr ? list->head : prev->next;
+        }
+    };
+    
+    /**
+     * Create a node pool suitable for sharing between lists of this type
+     * @param nodesPerSlab Nodes per slab (0 = pool default)
+     */
+    static std::shared_ptr<NodePool> makePool(size_t nodesPerSlab = 0) {
+        return std::make_shared<NodePool>(sizeof(Node), alignof(Node), nodesPerSlab);
+    }
+    
     /**
      * Constructor - Initialize empty linked list
      */
-    LinkedList() : head(nullptr), tail(nullptr), size(0) {}
+    LinkedList() : head(nullptr), tail(nullptr), size(0), pool(makePool()), fingerNode(nullptr), fingerIndex(0) {}
     
     /**
-     * Constructor with initializer list
+     * Constructor - Initialize empty linked list drawing nodes from a shared pool
+     * @param sharedPool Pool created with makePool() (or with a large enough node size)
+     * @throws std::invalid_argument if the pool is null or its nodes are too small
      */
-    LinkedList(std::initializer_list<T> init) : head(nullptr), tail(nullptr), size(0) {
-        for (const auto& item : init) {
-            pushBack(item);
+    explicit LinkedList(std::shared_ptr<NodePool> sharedPool)
+        : head(nullptr), tail(nullptr), size(0), pool(std::move(sharedPool)), fingerNode(nullptr), fingerIndex(0) {
+        if (!pool || !pool->fits(sizeof(Node), alignof(Node))) {
+            throw std::invalid_argument("Pool cannot hold list nodes");
         }
     }
     
     /**
-     * Copy constructor
+     * Constructor with initializer list
+     */
+    LinkedList(std::initializer_list<T> init) : head(nullptr), tail(nullptr), size(0), pool(makePool()), fingerNode(nullptr), fingerIndex(0) {
+        appendRange(init.begin(), init.end());
+    }
+    
+    /**
+     * Constructor from an iterator range
+     * Forward ranges get all their nodes from one contiguous block
+     * @param first Beginning of the range
+     * @param last End of the range
      */
-    LinkedList(const LinkedList& other) : head(nullptr), tail(nullptr), size(0) {
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    LinkedList(InputIt first, InputIt last) : head(nullptr), tail(nullptr), size(0), pool(makePool()), fingerNode(nullptr), fingerIndex(0) {
+        appendRange(first, last);
+    }
+    
+    /**
+     * Copy constructor (the copy gets its own pool)
+     */
+    LinkedList(const LinkedList& other) : head(nullptr), tail(nullptr), size(0), pool(makePool()), fingerNode(nullptr), fingerIndex(0) {
         copyFrom(other);
     }
     
+    /**
+     * Move constructor - Takes over the nodes of other in O(1)
+     * Both lists share other's pool afterwards, so the moved-from list
+     * stays usable (empty)
+     */
+    LinkedList(LinkedList&& other) noexcept
+        : head(other.head), tail(other.tail), size(other.size), pool(other.pool),
+          fingerNode(nullptr), fingerIndex(0) {
+        other.head = other.tail = nullptr;
+        other.size = 0;
+        other.invalidateFinger();
+    }
+    
     /**
      * Assignment operator
      */
@@ -70,6 +347,23 @@ public:
         return *this;
     }
     
+    /**
+     * Move assignment operator - Frees current nodes, then takes over other's
+     */
+    LinkedList& operator=(LinkedList&& other) noexcept {
+        if (this != &other) {
+            clear();
+            head = other.head;
+            tail = other.tail;
+            size = other.size;
+            pool = other.pool;
+            other.head = other.tail = nullptr;
+            other.size = 0;
+            other.invalidateFinger();
+        }
+        return *this;
+    }
+    
     /**
      * Destructor - Clean up all nodes
      */
@@ -82,7 +376,39 @@ public:
      * @param value Element to add
      */
     void pushFront(const T& value) {
-        Node* newNode = new Node(value);
+        emplaceFront(value);
+    }
+    
+    /**
+     * Add element to the front of the list, moving it in
+     */
+    void pushFront(T&& value) {
+        emplaceFront(std::move(value));
+    }
+    
+    /**
+     * Add element to the back of the list
+     * @param value Element to add
+     */
+    void pushBack(const T& value) {
+        emplaceBack(value);
+    }
+    
+    /**
+     * Add element to the back of the list, moving it in
+     */
+    void pushBack(T&& value) {
+        emplaceBack(std::move(value));
+    }
+    
+    /**
+     * Construct element in place at the front of the list
+     * @param args Arguments forwarded to T's constructor
+     * @return Reference to the new element
+     */
+    template <typename... Args>
+    T& emplaceFront(Args&&... args) {
+        Node* newNode = createNode(std::forward<Args>(args)...);
         if (isEmpty()) {
             head = tail = newNode;
         } else {
@@ -90,14 +416,18 @@ public:
             head = newNode;
         }
         size++;
+        fingerInserted(0);
+        return newNode->data;
     }
     
     /**
-     * Add element to the back of the list
-     * @param value Element to add
+     * Construct element in place at the back of the list
+     * @param args Arguments forwarded to T's constructor
+     * @return Reference to the new element
      */
-    void pushBack(const T& value) {
-        Node* newNode = new Node(value);
+    template <typename... Args>
+    T& emplaceBack(Args&&... args) {
+        Node* newNode = createNode(std::forward<Args>(args)...);
         if (isEmpty()) {
             head = tail = newNode;
         } else {
@@ -105,6 +435,7 @@ public:
             tail = newNode;
         }
         size++;
+        return newNode->data;
     }
     
     /**
@@ -114,34 +445,51 @@ public:
      * @throws std::out_of_range if index is invalid
      */
     void insert(size_t index, const T& value) {
+        emplaceAt(index, value);
+    }
+    
+    /**
+     * Insert element at specific index, moving it in
+     * @throws std::out_of_range if index is invalid
+     */
+    void insert(size_t index, T&& value) {
+        emplaceAt(index, std::move(value));
+    }
+    
+    /**
+     * Construct element in place at specific index
+     * @param index Position to insert at
+     * @param args Arguments forwarded to T's constructor
+     * @return Reference to the new element
+     * @throws std::out_of_range if index is invalid
+     */
+    template <typename... Args>
+    T& emplaceAt(size_t index, Args&&... args) {
         if (index > size) {
             throw std::out_of_range("Index out of range");
         }
         
         if (index == 0) {
-            pushFront(value);
-            return;
+            return emplaceFront(std::forward<Args>(args)...);
         }
         
         if (index == size) {
-            pushBack(value);
-            return;
-        }
-        
-        Node* newNode = new Node(value);
-        Node* current = head;
-        for (size_t i = 0; i < index - 1; ++i) {
-            current = current->next;
+            return emplaceBack(std::forward<Args>(args)...);
         }
         
+        Node* current = nodeAt(index - 1);
+        Node* newNode = createNode(std::forward<Args>(args)...);
         newNode->next = current->next;
         current->next = newNode;
         size++;
+        fingerNode = newNode;
+        fingerIndex = index;
+        return newNode->data;
     }
     
     /**
      * Remove element from the front of the list
-     * @return The removed element
+     * @return The removed element (moved out of the node)
      * @throws std::underflow_error if list is empty
      */
     T popFront() {
@@ -150,21 +498,23 @@ public:
         }
         
         Node* temp = head;
-        T value = temp->data;
+        T value = std::move(temp->data);
         
         head = head->next;
         if (head == nullptr) {
             tail = nullptr;
         }
+        fingerErased(0, temp);
         
-        delete temp;
+        destroyNode(temp);
         size--;
+        maybeCompact();
         return value;
     }
     
     /**
      * Remove element from the back of the list
-     * @return The removed element
+     * @return The removed element (moved out of the node)
      * @throws std::underflow_error if list is empty
      */
     T popBack() {
@@ -176,23 +526,20 @@ public:
             return popFront();
         }
         
-        Node* current = head;
-        while (current->next != tail) {
-            current = current->next;
-        }
-        
-        T value = tail->data;
-        delete tail;
+        Node* current = nodeAt(size - 2);
+        T value = std::move(tail->data);
+        destroyNode(tail);
         tail = current;
         tail->next = nullptr;
         size--;
+        maybeCompact();
         return value;
     }
     
     /**
      * Remove element at specific index
      * @param index Position to remove from
-     * @return The removed element
+     * @return The removed element (moved out of the node)
      * @throws std::out_of_range if index is invalid
      */
     T removeAt(size_t index) {
@@ -208,16 +555,13 @@ public:
             return popBack();
         }
         
-        Node* current = head;
-        for (size_t i = 0; i < index - 1; ++i) {
-            current = current->next;
-        }
-        
+        Node* current = nodeAt(index - 1);
         Node* nodeToDelete = current->next;
-        T value = nodeToDelete->data;
+        T value = std::move(nodeToDelete->data);
         current->next = nodeToDelete->next;
-        delete nodeToDelete;
+        destroyNode(nodeToDelete);
         size--;
+        maybeCompact();
         return value;
     }
     
@@ -252,8 +596,10 @@ public:
             tail = current;
         }
         
-        delete nodeToDelete;
+        invalidateFinger();
+        destroyNode(nodeToDelete);
         size--;
+        maybeCompact();
         return true;
     }
     
@@ -268,26 +614,20 @@ public:
             throw std::out_of_range("Index out of range");
         }
         
-        Node* current = head;
-        for (size_t i = 0; i < index; ++i) {
-            current = current->next;
-        }
-        return current->data;
+        return nodeAt(index)->data;
     }
     
     /**
      * Get element at specific index (const version)
+     * Starts from the finger but never moves it, so concurrent const
+     * lookups do not write to the list
      */
     const T& at(size_t index) const {
         if (index >= size) {
             throw std::out_of_range("Index out of range");
         }
         
-        Node* current = head;
-        for (size_t i = 0; i < index; ++i) {
-            current = current->next;
-        }
-        return current->data;
+        return findNode(index)->data;
     }
     
     /**
@@ -381,13 +721,142 @@ public:
     
     /**
      * Clear all elements from list
+     * When the pool is not shared its slabs are released as a whole
      */
     void clear() {
-        while (!isEmpty()) {
-            popFront();
+        bool privatePool = pool.use_count() == 1;
+        
+        if (!privatePool || !std::is_trivially_destructible<T>::value) {
+            Node* current = head;
+            while (current != nullptr) {
+                Node* next = current->next;
+                if (privatePool) {
+                    current->~Node();   // Memory goes back with the slabs
+                } else {
+                    destroyNode(current);
+                }
+                current = next;
+            }
+        }
+        
+        head = tail = nullptr;
+        size = 0;
+        churn = 0;
+        invalidateFinger();
+        if (privatePool) {
+            pool->release();
         }
     }
     
+    /**
+     * Replace contents with the elements of a range
+     * Forward ranges get all their nodes from one contiguous block
+     */
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    void assign(InputIt first, InputIt last) {
+        clear();
+        appendRange(first, last);
+    }
+    
+    /**
+     * Replace contents with the elements of an initializer list
+     */
+    void assign(std::initializer_list<T> init) {
+        assign(init.begin(), init.end());
+    }
+    
+    /**
+     * Replace contents with count copies of value
+     */
+    void assign(size_t count, const T& value) {
+        clear();
+        pool->reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            linkBack(createNode(value));
+        }
+    }
+    
+    /**
+     * Get the pool this list allocates nodes from
+     */
+    const std::shared_ptr<NodePool>& getPool() const {
+        return pool;
+    }
+    
+    /**
+     * Move all elements into one contiguous block, in list order
+     * The list gets a fresh private pool (leaving a shared pool, if any).
+     * Invalidates every iterator and cursor. Elements are moved when their
+     * move constructor is noexcept and copied otherwise, so a throwing
+     * element leaves the list unchanged.
+     */
+    void compact() {
+        std::shared_ptr<NodePool> fresh = makePool();
+        fresh->reserve(size);
+        
+        Node* newHead = nullptr;
+        Node* newTail = nullptr;
+        try {
+            for (Node* current = head; current != nullptr; current = current->next) {
+                void* memory = fresh->allocate();
+                Node* node;
+                try {
+                    node = new (memory) Node(std::move_if_noexcept(current->data));
+                } catch (...) {
+                    fresh->deallocate(memory);
+                    throw;
+                }
+                if (newTail == nullptr) {
+                    newHead = node;
+                } else {
+                    newTail->next = node;
+                }
+                newTail = node;
+            }
+        } catch (...) {
+            for (Node* node = newHead; node != nullptr; node = node->next) {
+                node->~Node();
+            }
+            throw;
+        }
+        
+        size_t count = size;
+        clear();
+        pool = std::move(fresh);
+        head = newHead;
+        tail = newTail;
+        size = count;
+    }
+    
+    /**
+     * Fraction of links that lead to the adjacent slot in memory
+     * @return Value in [0, 1]; 1 for a freshly compacted (or tiny) list
+     */
+    double locality() const {
+        if (size < 2) {
+            return 1.0;
+        }
+        
+        size_t stride = pool->getNodeSize();
+        size_t adjacent = 0;
+        for (Node* current = head; current->next != nullptr; current = current->next) {
+            if (reinterpret_cast<char*>(current->next) == reinterpret_cast<char*>(current) + stride) {
+                adjacent++;
+            }
+        }
+        return static_cast<double>(adjacent) / (size - 1);
+    }
+    
+    /**
+     * Compact automatically after churn once locality drops below threshold
+     * While enabled, popFront, popBack, removeAt and remove may invalidate
+     * every iterator and cursor
+     * @param threshold Locality in (0, 1] that triggers compaction; 0 disables
+     */
+    void setAutoCompact(double threshold) {
+        autoCompactThreshold = threshold;
+    }
+    
     /**
      * Reverse the linked list
      */
@@ -406,6 +875,7 @@ public:
         }
         
         head = prev; // prev is now the new head
+        invalidateFinger();
     }
     
     /**
@@ -429,6 +899,276 @@ public:
         std::cout << " (size: " << size << ")" << std::endl;
     }
     
+    /**
+     * Iterator to the first element
+     */
+    iterator begin() {
+        return iterator(head);
+    }
+    
+    /**
+     * Iterator past the last element
+     */
+    iterator end() {
+        return iterator(nullptr);
+    }
+    
+    const_iterator begin() const {
+        return const_iterator(head);
+    }
+    
+    const_iterator end() const {
+        return const_iterator(nullptr);
+    }
+    
+    const_iterator cbegin() const {
+        return const_iterator(head);
+    }
+    
+    const_iterator cend() const {
+        return const_iterator(nullptr);
+    }
+    
+    /**
+     * Insert element right after the element at pos
+     * @param pos Iterator to an element of this list
+     * @param value Element to insert
+     * @return Iterator to the inserted element
+     * @throws std::out_of_range if pos is end()
+     */
+    iterator insertAfter(const_iterator pos, const T& value) {
+        return emplaceAfter(pos, value);
+    }
+    
+    /**
+     * Insert element right after the element at pos, moving it in
+     * @throws std::out_of_range if pos is end()
+     */
+    iterator insertAfter(const_iterator pos, T&& value) {
+        return emplaceAfter(pos, std::move(value));
+    }
+    
+    /**
+     * Construct element in place right after the element at pos
+     * @param pos Iterator to an element of this list
+     * @param args Arguments forwarded to T's constructor
+     * @return Iterator to the new element
+     * @throws std::out_of_range if pos is end()
+     */
+    template <typename... Args>
+    iterator emplaceAfter(const_iterator pos, Args&&... args) {
+        if (pos.node == nullptr) {
+            throw std::out_of_range("Iterator out of range");
+        }
+        
+        Node* newNode = createNode(std::forward<Args>(args)...);
+        newNode->next = pos.node->next;
+        pos.node->next = newNode;
+        if (pos.node == tail) {
+            tail = newNode;
+        }
+        size++;
+        invalidateFinger();
+        return iterator(newNode);
+    }
+    
+    /**
+     * Construct element in place right before the element at pos
+     * O(n): a singly linked list has to walk to the predecessor
+     * (O(1) when pos is begin() or end())
+     * @param pos Iterator to an element of this list, or end()
+     * @param args Arguments forwarded to T's constructor
+     * @return Iterator to the new element
+     */
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
+        if (pos.node == head) {
+            emplaceFront(std::forward<Args>(args)...);
+            return iterator(head);
+        }
+        if (pos.node == nullptr) {
+            emplaceBack(std::forward<Args>(args)...);
+            return iterator(tail);
+        }
+        
+        Node* prev = head;
+        while (prev->next != pos.node) {
+            prev = prev->next;
+        }
+        return emplaceAfter(const_iterator(prev), std::forward<Args>(args)...);
+    }
+    
+    /**
+     * Remove the element right after the element at pos
+     * @param pos Iterator to an element of this list
+     * @return Iterator to the element following the removed one
+     * @throws std::out_of_range if pos is end() or the last element
+     */
+    iterator eraseAfter(const_iterator pos) {
+        if (pos.node == nullptr || pos.node->next == nullptr) {
+            throw std::out_of_range("Iterator out of range");
+        }
+        
+        Node* nodeToDelete = pos.node->next;
+        pos.node->next = nodeToDelete->next;
+        if (nodeToDelete == tail) {
+            tail = pos.node;
+        }
+        invalidateFinger();
+        destroyNode(nodeToDelete);
+        size--;
+        return iterator(pos.node->next);
+    }
+    
+    /**
+     * Move every element of other to the end of this list
+     * O(1) when the lists share a pool or other's pool is private (it is
+     * merged into this list's pool); O(k) element moves otherwise
+     * @param other List to drain (left empty)
+     */
+    void append(LinkedList&& other) {
+        spliceAfter(const_iterator(tail), other);
+    }
+    
+    /**
+     * Move every element of other into this list before pos
+     * O(1) when pos is begin() or end() and no element has to be moved
+     * (see append); otherwise the predecessor of pos is found by walking from the head
+     * @param pos Iterator into this list, or end()
+     * @param other List to drain (left empty)
+     */
+    void splice(const_iterator pos, LinkedList& other) {
+        spliceAfter(const_iterator(predecessor(pos.node)), other);
+    }
+    
+    void splice(const_iterator pos, LinkedList&& other) {
+        splice(pos, other);
+    }
+    
+    /**
+     * Move every element of other into this list right after pos
+     * @param pos Iterator to an element of this list (end() inserts at the front)
+     * @param other List to drain (left empty)
+     */
+    void spliceAfter(const_iterator pos, LinkedList& other) {
+        if (this == &other || other.isEmpty()) {
+            return;
+        }
+        
+        Node* first = other.head;
+        Node* last = other.tail;
+        size_t count = other.size;
+        other.head = other.tail = nullptr;
+        other.size = 0;
+        other.invalidateFinger();
+        
+        adoptChain(other, first, last);
+        linkChainAfter(pos.node, first, last, count);
+    }
+    
+    void spliceAfter(const_iterator pos, LinkedList&& other) {
+        spliceAfter(pos, other);
+    }
+    
+    /**
+     * Move the elements strictly between first and last from other into
+     * this list right after pos (like std::forward_list::splice_after)
+     * O(k) to count the moved elements
+     * @param pos Iterator to an element of this list (end() inserts at the front)
+     * @param other List the range belongs to (may be this list if pos is outside the range)
+     * @param first Iterator to an element of other preceding the range
+     * @param last Iterator one past the range (may be other.end())
+     * @throws std::out_of_range if first is end()
+     */
+    void spliceAfter(const_iterator pos, LinkedList& other, const_iterator first, const_iterator last) {
+        if (first.node == nullptr) {
+            throw std::out_of_range("Iterator out of range");
+        }
+        
+        Node* begin = first.node->next;
+        if (begin == last.node || pos.node == first.node) {
+            return;
+        }
+        
+        Node* end = begin;
+        size_t count = 1;
+        while (end->next != last.node) {
+            end = end->next;
+            count++;
+        }
+        
+        first.node->next = last.node;
+        if (end == other.tail) {
+            other.tail = first.node;
+        }
+        other.size -= count;
+        other.invalidateFinger();
+        end->next = nullptr;
+        
+        adoptChain(other, begin, end);
+        linkChainAfter(pos.node, begin, end, count);
+    }
+    
+    /**
+     * Detach the elements from pos to the end into a new list
+     * The new list shares this list's pool, so no element is copied
+     * @param pos Iterator into this list (end() returns an empty list)
+     * @return List holding [pos, end())
+     */
+    LinkedList splitAt(const_iterator pos) {
+        LinkedList rest(pool);
+        if (pos.node == nullptr) {
+            return rest;
+        }
+        
+        Node* prev = nullptr;
+        size_t kept = 0;
+        for (Node* current = head; current != pos.node; current = current->next) {
+            prev = current;
+            kept++;
+        }
+        
+        rest.head = pos.node;
+        rest.tail = tail;
+        rest.size = size - kept;
+        
+        if (prev == nullptr) {
+            head = tail = nullptr;
+        } else {
+            prev->next = nullptr;
+            tail = prev;
+        }
+        size = kept;
+        invalidateFinger();
+        return rest;
+    }
+    
+    /**
+     * Detach the elements from index to the end into a new list
+     * @param index First index to move (size returns an empty list)
+     * @return List holding the elements [index, size)
+     * @throws std::out_of_range if index is invalid
+     */
+    LinkedList splitAt(size_t index) {
+        if (index > size) {
+            throw std::out_of_range("Index out of range");
+        }
+        
+        return splitAt(const_iterator(index == size ? nullptr : nodeAt(index)));
+    }
+    
+    /**
+     * Get a cursor positioned at index (found through the finger)
+     * @param index Position of the cursor (size = at the end)
+     * @throws std::out_of_range if index is invalid
+     */
+    Cursor cursor(size_t index = 0) {
+        if (index > size) {
+            throw std::out_of_range("Index out of range");
+        }
+        return Cursor(this, index == 0 ? nullptr : nodeAt(index - 1), index);
+    }
+    
     /**
      * Operator[] for array-like access
      */
@@ -444,14 +1184,220 @@ public:
     }
 
 private:
+    /**
+     * Construct a node in memory taken from the pool
+     */
+    template <typename... Args>
+    Node* createNode(Args&&... args) {
+        void* memory = pool->allocate();
+        try {
+            return new (memory) Node(std::forward<Args>(args)...);
+        } catch (...) {
+            pool->deallocate(memory);
+            throw;
+        }
+    }
+    
+    /**
+     * Destroy a node and hand its memory back to the pool
+     */
+    void destroyNode(Node* node) {
+        node->~Node();
+        pool->deallocate(node);
+        churn++;
+    }
+    
+    /**
+     * Auto-compaction check; O(1) except once per size-many frees
+     */
+    void maybeCompact() {
+        static constexpr size_t MIN_COMPACT_SIZE = 64;
+        if (autoCompactThreshold <= 0 || churn < size || size < MIN_COMPACT_SIZE) {
+            return;
+        }
+        churn = 0;
+        if (locality() < autoCompactThreshold) {
+            compact();
+        }
+    }
+    
+    /**
+     * Node at index (index < size), walking from the finger when it is at
+     * or before index and from the head otherwise; leaves the finger alone
+     */
+    Node* findNode(size_t index) const {
+        Node* current = head;
+        size_t position = 0;
+        if (fingerNode != nullptr && fingerIndex <= index) {
+            current = fingerNode;
+            position = fingerIndex;
+        }
+        for (; position < index; ++position) {
+            current = current->next;
+        }
+        return current;
+    }
+    
+    /**
+     * Like findNode, then moves the finger to the node found
+     */
+    Node* nodeAt(size_t index) {
+        Node* current = findNode(index);
+        fingerNode = current;
+        fingerIndex = index;
+        return current;
+    }
+    
+    void invalidateFinger() {
+        fingerNode = nullptr;
+        fingerIndex = 0;
+    }
+    
+    /**
+     * Keep the finger valid after an element was inserted at index
+     */
+    void fingerInserted(size_t index) {
+        if (fingerNode != nullptr && fingerIndex >= index) {
+            fingerIndex++;
+        }
+    }
+    
+    /**
+     * Keep the finger valid after node was removed from index
+     */
+    void fingerErased(size_t index, Node* node) {
+        if (fingerNode == node) {
+            invalidateFinger();
+        } else if (fingerNode != nullptr && fingerIndex > index) {
+            fingerIndex--;
+        }
+    }
+    
+    /**
+     * Node right before target (nullptr when target is the head; the tail
+     * when target is nullptr, i.e. end())
+     */
+    Node* predecessor(Node* target) const {
+        if (target == nullptr) {
+            return tail;
+        }
+        
+        Node* prev = nullptr;
+        for (Node* current = head; current != target; current = current->next) {
+            prev = current;
+        }
+        return prev;
+    }
+    
+    /**
+     * Link a detached, null-terminated chain of count nodes after pos
+     * (at the front when pos is nullptr)
+     */
+    void linkChainAfter(Node* pos, Node* first, Node* last, size_t count) {
+        if (pos == nullptr) {
+            last->next = head;
+            head = first;
+            if (tail == nullptr) {
+                tail = last;
+            }
+        } else {
+            last->next = pos->next;
+            pos->next = first;
+            if (pos == tail) {
+                tail = last;
+            }
+        }
+        size += count;
+        invalidateFinger();
+    }
+    
+    /**
+     * Make a chain detached from other usable in this list
+     * Nodes from a shared pool are kept as they are. A private pool of other
+     * is merged into this list's pool, which other then shares. Otherwise
+     * each element is moved into a node from this list's pool and the old
+     * node is freed
+     */
+    void adoptChain(LinkedList& other, Node*& first, Node*& last) {
+        if (pool == other.pool) {
+            return;
+        }
+        if (other.pool.use_count() == 1 && pool->canAdopt(*other.pool)) {
+            pool->adopt(*other.pool);
+            other.pool = pool;
+            return;
+        }
+        
+        Node* newFirst = nullptr;
+        Node* newLast = nullptr;
+        Node* current = first;
+        try {
+            while (current != nullptr) {
+                Node* node = createNode(std::move(current->data));
+                if (newLast == nullptr) {
+                    newFirst = node;
+                } else {
+                    newLast->next = node;
+                }
+                newLast = node;
+                
+                Node* next = current->next;
+                other.destroyNode(current);
+                current = next;
+            }
+        } catch (...) {
+            // Elements not yet moved are lost; both lists stay valid
+            while (current != nullptr) {
+                Node* next = current->next;
+                other.destroyNode(current);
+                current = next;
+            }
+            while (newFirst != nullptr) {
+                Node* next = newFirst->next;
+                destroyNode(newFirst);
+                newFirst = next;
+            }
+            throw;
+        }
+        
+        first = newFirst;
+        last = newLast;
+    }
+    
+    /**
+     * Link a fresh node after the tail
+     */
+    void linkBack(Node* node) {
+        if (tail == nullptr) {
+            head = node;
+        } else {
+            tail->next = node;
+        }
+        tail = node;
+        size++;
+    }
+    
+    /**
+     * Append the elements of a range, reserving one block for forward ranges
+     */
+    template <typename InputIt>
+    void appendRange(InputIt first, InputIt last) {
+        using Category = typename std::iterator_traits<InputIt>::iterator_category;
+        if constexpr (std::is_base_of<std::forward_iterator_tag, Category>::value) {
+            pool->reserve(static_cast<size_t>(std::distance(first, last)));
+        }
+        for (; first != last; ++first) {
+            linkBack(createNode(*first));
+        }
+    }
+    
     /**
      * Helper function to copy from another list
      */
     void copyFrom(const LinkedList& other) {
-        Node* current = other.head;
-        while (current != nullptr) {
-            pushBack(current->data);
-            current = current->next;
+        pool->reserve(other.size);
+        for (Node* current = other.head; current != nullptr; current = current->next) {
+            linkBack(createNode(current->data));
         }
     }
 };
@@ -0,0 +1,275 @@
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <new>
+#include <vector>
+#include <cstddef>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * Fixed-Size Node Pool (slab allocator with free list)
+ *
+ * Time Complexity:
+ * - Allocate: O(1) - pop the free list or bump into the current slab
+ * - Deallocate: O(1) - push onto the free list
+ * - Release: O(s) where s is the number of slabs
+ * - Adopt another pool: O(s) of the adopted pool
+ *
+ * Space Complexity: O(s * slab size), at most about twice the peak number
+ * of live nodes while slabs are still growing
+ *
+ * Node-based containers allocate one small node per element. Asking malloc
+ * for each of them is slow and scatters the nodes across the heap. A pool
+ * carves nodes out of cache-line-aligned slabs instead: freed nodes are
+ * recycled through an intrusive free list, and release() returns whole
+ * slabs at once. Several containers may share one pool (not thread-safe).
+ *
+ * By default the first slab holds only INITIAL_SLAB_NODES nodes and each
+ * further slab doubles, up to about DEFAULT_SLAB_BYTES, so a pool behind a
+ * short list stays small. Passing perSlab fixes the slab size instead.
+ */
+class NodePool {
+public:
+    static constexpr size_t CACHE_LINE = 64;
+    static constexpr size_t DEFAULT_SLAB_BYTES = 16384;
+    static constexpr size_t INITIAL_SLAB_NODES = 4;
+
+private:
+    /**
+     * Free nodes are linked through their own storage
+     */
+    struct FreeNode {
+        FreeNode* next;
+    };
+
+    /**
+     * One contiguous block of nodes
+     */
+    struct Slab {
+        void* memory;
+        size_t bytes;
+    };
+
+    size_t nodeSize;        // Bytes per node (multiple of nodeAlign)
+    size_t nodeAlign;       // Alignment of every node
+    size_t firstSlabNodes;  // Nodes in the first slab
+    size_t maxSlabNodes;    // Slab size the geometric growth stops at
+    size_t nextSlabNodes;   // Nodes in the next regular slab
+    FreeNode* freeList;     // Recycled nodes
+    FreeNode* freeTail;     // Last recycled node (for O(1) adopt)
+    char* bump;             // Next never-used node in the newest slab
+    char* bumpEnd;          // End of the newest slab
+    std::vector<Slab> slabs;
+    size_t liveCount;       // Nodes handed out and not yet returned
+
+public:
+    /**
+     * Constructor
+     * @param size Size of each node in bytes
+     * @param align Alignment of each node (power of two)
+     * @param perSlab Nodes per slab (0 = grow from INITIAL_SLAB_NODES to about DEFAULT_SLAB_BYTES)
+     * @throws std::invalid_argument if size is zero or align is not a power of two
+     */
+    explicit NodePool(size_t size, size_t align = alignof(std::max_align_t), size_t perSlab = 0)
+        : freeList(nullptr), freeTail(nullptr), bump(nullptr), bumpEnd(nullptr), liveCount(0) {
+        if (size == 0 || align == 0 || (align & (align - 1)) != 0) {
+            throw std::invalid_argument("Invalid node size or alignment");
+        }
+
+        nodeAlign = std::max(align, alignof(FreeNode));
+        nodeSize = std::max(size, sizeof(FreeNode));
+        nodeSize = (nodeSize + nodeAlign - 1) / nodeAlign * nodeAlign;
+        if (perSlab != 0) {
+            firstSlabNodes = maxSlabNodes = perSlab;
+        } else {
+            maxSlabNodes = std::max<size_t>(16, DEFAULT_SLAB_BYTES / nodeSize);
+            firstSlabNodes = INITIAL_SLAB_NODES;
+        }
+        nextSlabNodes = firstSlabNodes;
+    }
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    /**
+     * Destructor - Return every slab to the system
+     */
+    ~NodePool() {
+        release();
+    }
+
+    /**
+     * Get memory for one node
+     * @return Pointer to nodeSize bytes aligned to nodeAlign
+     */
+    void* allocate() {
+        if (freeList != nullptr) {
+            FreeNode* node = freeList;
+            freeList = node->next;
+            if (freeList == nullptr) {
+                freeTail = nullptr;
+            }
+            liveCount++;
+            return node;
+        }
+
+        if (bump == bumpEnd) {
+            addSlab(nextSlabNodes);
+        }
+
+        void* node = bump;
+        bump += nodeSize;
+        liveCount++;
+        return node;
+    }
+
+    /**
+     * Return one node to the pool
+     * @param node Pointer obtained from allocate() of this pool
+     */
+    void deallocate(void* node) {
+        FreeNode* freed = static_cast<FreeNode*>(node);
+        freed->next = freeList;
+        if (freeList == nullptr) {
+            freeTail = freed;
+        }
+        freeList = freed;
+        liveCount--;
+    }
+
+    /**
+     * Make sure the next count allocations come from one contiguous block
+     * (only guaranteed while the free list is empty)
+     * @param count Number of nodes about to be allocated
+     */
+    void reserve(size_t count) {
+        size_t available = static_cast<size_t>(bumpEnd - bump) / nodeSize;
+        if (available < count) {
+            addSlab(std::max(count, nextSlabNodes));
+        }
+    }
+
+    /**
+     * Free every slab at once
+     * Every node handed out by this pool becomes invalid
+     */
+    void release() {
+        for (const auto& slab : slabs) {
+            ::operator delete(slab.memory, std::align_val_t(slabAlign()));
+        }
+        slabs.clear();
+        freeList = freeTail = nullptr;
+        bump = bumpEnd = nullptr;
+        liveCount = 0;
+        nextSlabNodes = firstSlabNodes;
+    }
+    
+    /**
+     * Check whether adopt(other) is allowed (same node layout)
+     */
+    bool canAdopt(const NodePool& other) const {
+        return nodeSize == other.nodeSize && nodeAlign == other.nodeAlign;
+    }
+    
+    /**
+     * Take over every slab of other, including its live nodes, which may
+     * then be returned to this pool; other is left empty
+     * Of the two unused slab tails, the longer one stays usable
+     * @throws std::invalid_argument if the node layouts differ
+     */
+    void adopt(NodePool& other) {
+        if (this == &other) {
+            return;
+        }
+        if (!canAdopt(other)) {
+            throw std::invalid_argument("Pools have different node layouts");
+        }
+        
+        slabs.insert(slabs.end(), other.slabs.begin(), other.slabs.end());
+        
+        if (other.freeList != nullptr) {
+            other.freeTail->next = freeList;
+            if (freeList == nullptr) {
+                freeTail = other.freeTail;
+            }
+            freeList = other.freeList;
+        }
+        if (other.bumpEnd - other.bump > bumpEnd - bump) {
+            bump = other.bump;
+            bumpEnd = other.bumpEnd;
+        }
+        liveCount += other.liveCount;
+        nextSlabNodes = std::max(nextSlabNodes, other.nextSlabNodes);
+        
+        other.slabs.clear();
+        other.freeList = other.freeTail = nullptr;
+        other.bump = other.bumpEnd = nullptr;
+        other.liveCount = 0;
+        other.nextSlabNodes = other.firstSlabNodes;
+    }
+
+    /**
+     * Get size of each node in bytes (after rounding)
+     */
+    size_t getNodeSize() const {
+        return nodeSize;
+    }
+
+    /**
+     * Get alignment of each node
+     */
+    size_t getNodeAlign() const {
+        return nodeAlign;
+    }
+
+    /**
+     * Get number of nodes currently handed out
+     */
+    size_t getLiveCount() const {
+        return liveCount;
+    }
+
+    /**
+     * Get number of slabs currently held
+     */
+    size_t getSlabCount() const {
+        return slabs.size();
+    }
+
+    /**
+     * Get total bytes held in slabs
+     */
+    size_t getReservedBytes() const {
+        size_t total = 0;
+        for (const auto& slab : slabs) total += slab.bytes;
+        return total;
+    }
+
+    /**
+     * Check whether nodes of the given layout can be served by this pool
+     */
+    bool fits(size_t size, size_t align) const {
+        return size <= nodeSize && align <= nodeAlign;
+    }
+
+private:
+    size_t slabAlign() const {
+        return std::max(nodeAlign, CACHE_LINE);
+    }
+
+    void addSlab(size_t count) {
+        size_t bytes = count * nodeSize;
+        if (slabs.size() == slabs.capacity()) {
+            slabs.reserve(std::max<size_t>(4, slabs.size() * 2));
+        }
+        void* memory = ::operator new(bytes, std::align_val_t(slabAlign()));
+        slabs.push_back({memory, bytes});
+        bump = static_cast<char*>(memory);
+        bumpEnd = bump + bytes;
+        nextSlabNodes = std::min(nextSlabNodes * 2, maxSlabNodes);
+    }
+};
+
+#endif // NODE_POOL_H
@@ -0,0 +1,290 @@
+#ifndef OPTIMISTIC_SORTED_LIST_H
+#define OPTIMISTIC_SORTED_LIST_H
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <iostream>
+#include <functional>
+#include "epoch_manager.h"
+
+/**
+ * Concurrent Sorted Linked List with Optimistic Versioned Locks
+ *
+ * Time Complexity:
+ * - Insert: O(n) traversal without locks, then one node lock
+ * - Remove: O(n) traversal without locks, then two node locks
+ * - Contains: O(n), never locks and never retries
+ *
+ * Space Complexity: O(n) plus nodes awaiting reclamation
+ *
+ * Elements are kept sorted and unique. Every link holder (the head and
+ * each node) has a version word whose low bit is a spinlock. Any change to
+ * a node's next pointer or deleted flag happens under that lock, and
+ * unlocking bumps the version. Writers traverse without locking and
+ * remember the version they saw at the predecessor. They then lock it with
+ * a single compare-and-swap from that version. The CAS succeeds only if
+ * nothing changed in between, so acquiring the lock also validates the
+ * window. If it fails, the writer starts over. Only writers touching the
+ * same nodes contend, and operations on different regions of the list run
+ * in parallel.
+ *
+ * Removal marks the victim as deleted and unlinks it while holding the
+ * locks of both the predecessor and the victim. Readers never lock; they
+ * skip deleted nodes (as in the lazy list). Unlinked nodes are retired
+ * through an EpochManager, and every operation pins the calling thread,
+ * so traversals never touch freed memory.
+ *
+ * Compared with ConcurrentSortedList (lock-free), writers can block each
+ * other briefly on shared nodes, but no CAS loops run on hot links and
+ * readers do less work.
+ */
+template <typename T, typename Compare = std::less<T>>
+class OptimisticSortedList {
+private:
+    struct Node;
+
+    /**
+     * Lockable link holder (the head sentinel, and the base of every node)
+     */
+    struct Link {
+        std::atomic<uint64_t> version{0};   // Odd = locked
+        std::atomic<bool> deleted{false};   // Set once, under the lock
+        std::atomic<Node*> next{nullptr};
+    };
+
+    /**
+     * Node structure for the list
+     */
+    struct Node : Link {
+        T key;
+
+        Node(const T& value, Node* successor) : key(value) {
+            this->next.store(successor, std::memory_order_relaxed);
+        }
+    };
+
+    /**
+     * Position found by an unlocked traversal
+     */
+    struct Window {
+        Link* prev;
+        uint64_t prevVersion;   // Version of prev observed before reading prev->next
+        Node* curr;             // First node not ordered before the key (nullptr if none)
+    };
+
+    Link head;
+    std::atomic<size_t> size;   // Element count (exact when quiescent)
+    Compare compare;
+    EpochManager epochs;        // Reclaims unlinked nodes
+
+public:
+    /**
+     * Constructor - Initialize empty list
+     */
+    explicit OptimisticSortedList(const Compare& comp = Compare()) : size(0), compare(comp) {}
+
+    OptimisticSortedList(const OptimisticSortedList&) = delete;
+    OptimisticSortedList& operator=(const OptimisticSortedList&) = delete;
+
+    /**
+     * Destructor - No thread may be using the list any more
+     */
+    ~OptimisticSortedList() {
+        Node* current = head.next.load(std::memory_order_relaxed);
+        while (current != nullptr) {
+            Node* next = current->next.load(std::memory_order_relaxed);
+            delete current;
+            current = next;
+        }
+    }
+
+    /**
+     * Add value if it is not already present
+     * @return true if inserted, false if an equal element exists
+     */
+    bool insert(const T& value) {
+        EpochManager::Guard guard = epochs.local().pin();
+
+        for (size_t attempt = 0;; ++attempt) {
+            Window window = find(value);
+            if (window.curr != nullptr && !compare(value, window.curr->key)) {
+                return false;
+            }
+            if (!tryLock(window.prev, window.prevVersion)) {
+                backoff(attempt);
+                continue;
+            }
+
+            // Locked at the observed version: prev is live and still points at curr
+            Node* node = new Node(value, window.curr);
+            window.prev->next.store(node, std::memory_order_release);
+            unlock(window.prev);
+            size.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    /**
+     * Remove value
+     * @return true if this call removed it, false if it was not present
+     */
+    bool remove(const T& value) {
+        EpochManager::Handle& handle = epochs.local();
+        EpochManager::Guard guard = handle.pin();
+
+        for (size_t attempt = 0;; ++attempt) {
+            Window window = find(value);
+            if (window.curr == nullptr || compare(value, window.curr->key)) {
+                return false;
+            }
+
+            Node* victim = window.curr;
+            uint64_t victimVersion = victim->version.load(std::memory_order_acquire);
+            if (!tryLock(window.prev, window.prevVersion)) {
+                backoff(attempt);
+                continue;
+            }
+            if (!tryLock(victim, victimVersion)) {
+                unlock(window.prev);
+                backoff(attempt);
+                continue;
+            }
+
+            victim->deleted.store(true, std::memory_order_release);
+            window.prev->next.store(victim->next.load(std::memory_order_acquire), std::memory_order_release);
+            unlock(victim);
+            unlock(window.prev);
+
+            size.fetch_sub(1, std::memory_order_relaxed);
+            handle.retire(victim);
+            return true;
+        }
+    }
+
+    /**
+     * Check if value is present (no locks, no retries)
+     */
+    bool contains(const T& value) {
+        EpochManager::Guard guard = epochs.local().pin();
+
+        Node* current = head.next.load(std::memory_order_acquire);
+        while (current != nullptr && compare(current->key, value)) {
+            current = current->next.load(std::memory_order_acquire);
+        }
+        return current != nullptr && !compare(value, current->key) &&
+               !current->deleted.load(std::memory_order_acquire);
+    }
+
+    /**
+     * Visit every present element in order
+     * Weakly consistent: concurrent updates may or may not be observed
+     */
+    template <typename Func>
+    void forEach(Func visit) {
+        EpochManager::Guard guard = epochs.local().pin();
+
+        for (Node* current = head.next.load(std::memory_order_acquire); current != nullptr;
+             current = current->next.load(std::memory_order_acquire)) {
+            if (!current->deleted.load(std::memory_order_acquire)) {
+                visit(current->key);
+            }
+        }
+    }
+
+    /**
+     * Copy present elements into a vector (weakly consistent, see forEach)
+     */
+    std::vector<T> toVector() {
+        std::vector<T> result;
+        forEach([&](const T& key) { result.push_back(key); });
+        return result;
+    }
+
+    /**
+     * Get number of elements (may lag behind concurrent updates)
+     */
+    size_t getSize() const {
+        return size.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Check if list is empty (may lag behind concurrent updates)
+     */
+    bool isEmpty() const {
+        return getSize() == 0;
+    }
+
+    /**
+     * Display list contents (for debugging)
+     */
+    void display() {
+        std::vector<T> items = toVector();
+        if (items.empty()) {
+            std::cout << "List is empty" << std::endl;
+            return;
+        }
+
+        std::cout << "List: ";
+        for (size_t i = 0; i < items.size(); ++i) {
+            std::cout << items[i];
+            if (i + 1 < items.size()) {
+                std::cout << " -> ";
+            }
+        }
+        std::cout << " (size: " << items.size() << ")" << std::endl;
+    }
+
+private:
+    /**
+     * Unlocked traversal to the window for value; the caller must be pinned
+     */
+    Window find(const T& value) {
+        Link* prev = &head;
+        uint64_t prevVersion = prev->version.load(std::memory_order_acquire);
+        Node* curr = prev->next.load(std::memory_order_acquire);
+
+        while (curr != nullptr && compare(curr->key, value)) {
+            prev = curr;
+            prevVersion = prev->version.load(std::memory_order_acquire);
+            curr = prev->next.load(std::memory_order_acquire);
+        }
+        return {prev, prevVersion, curr};
+    }
+
+    /**
+     * Lock link only if its version is still the one observed (and unlocked),
+     * and it has not been deleted
+     */
+    static bool tryLock(Link* link, uint64_t observed) {
+        if ((observed & 1) != 0) {
+            return false;
+        }
+        if (!link->version.compare_exchange_strong(observed, observed + 1,
+                                                   std::memory_order_acquire, std::memory_order_relaxed)) {
+            return false;
+        }
+        if (link->deleted.load(std::memory_order_relaxed)) {
+            unlock(link);
+            return false;
+        }
+        return true;
+    }
+
+    static void unlock(Link* link) {
+        link->version.fetch_add(1, std::memory_order_release);
+    }
+
+    /**
+     * Back off after a failed validation: retry at once a few times, then yield
+     */
+    static void backoff(size_t attempt) {
+        if (attempt >= 4) {
+            std::this_thread::yield();
+        }
+    }
+};
+
+#endif // OPTIMISTIC_SORTED_LIST_H
@@ -0,0 +1,368 @@
+#ifndef PERSISTENT_LIST_H
+#define PERSISTENT_LIST_H
+
+#include <atomic>
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <iterator>
+#include <iostream>
+#include <stdexcept>
+#include <initializer_list>
+
+/**
+ * Persistent (Immutable) Singly Linked List Implementation in C++
+ *
+ * Time Complexity:
+ * - Push front (new version): O(1)
+ * - Pop front (new version): O(1)
+ * - Copy / snapshot: O(1) - one reference count increment
+ * - Front, size, isEmpty: O(1)
+ * - Access by index / search: O(n)
+ * - Reverse (new version): O(n)
+ *
+ * Space Complexity: O(n) across all versions that share a tail; each
+ * pushFront adds exactly one node
+ *
+ * A version is a pointer to its first node, and nodes are never modified
+ * after construction. pushFront therefore returns a new version that
+ * shares the whole old list as its tail, and copying a version copies
+ * a pointer. Nodes are reference counted atomically, so versions can be
+ * handed to reader threads and dropped on any thread. The last owner
+ * frees a chain iteratively, so long lists cannot overflow the stack on
+ * destruction. One PersistentList object must not be assigned while
+ * another thread reads that same object. Distinct objects sharing nodes
+ * are always safe.
+ */
+template <typename T>
+class PersistentList {
+private:
+    /**
+     * Immutable node; refs counts versions and nodes pointing at it
+     */
+    struct Node {
+        const T data;
+        const Node* const next;
+        mutable std::atomic<size_t> refs;
+
+        template <typename... Args>
+        Node(const Node* successor, Args&&... args)
+            : data(std::forward<Args>(args)...), next(successor), refs(1) {}
+    };
+
+    const Node* head;   // First node of this version (owned reference)
+    size_t size;        // Number of elements in this version
+
+    PersistentList(const Node* first, size_t count) : head(first), size(count) {}
+
+    static const Node* acquire(const Node* node) {
+        if (node != nullptr) {
+            node->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+        return node;
+    }
+
+    /**
+     * Drop one reference; frees every node whose count reaches zero
+     */
+    static void release(const Node* node) {
+        while (node != nullptr && node->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            const Node* next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+
+public:
+    /**
+     * Forward iterator over a version (read-only)
+     */
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        Iterator() : node(nullptr) {}
+
+        reference operator*() const {
+            return node->data;
+        }
+
+        pointer operator->() const {
+            return &node->data;
+        }
+
+        Iterator& operator++() {
+            node = node->next;
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator old = *this;
+            node = node->next;
+            return old;
+        }
+
+        friend bool operator==(const Iterator& a, const Iterator& b) {
+            return a.node == b.node;
+        }
+
+        friend bool operator!=(const Iterator& a, const Iterator& b) {
+            return a.node != b.node;
+        }
+
+    private:
+        friend class PersistentList;
+
+        const Node* node;
+
+        explicit Iterator(const Node* n) : node(n) {}
+    };
+
+    using iterator = Iterator;
+    using const_iterator = Iterator;
+
+    /**
+     * Constructor - Initialize empty list
+     */
+    PersistentList() : head(nullptr), size(0) {}
+
+    /**
+     * Constructor with initializer list (first item becomes the front)
+     */
+    PersistentList(std::initializer_list<T> init) : head(nullptr), size(0) {
+        try {
+            for (auto it = init.end(); it != init.begin();) {
+                --it;
+                head = new Node(head, *it);
+                size++;
+            }
+        } catch (...) {
+            // The destructor does not run for a throwing constructor
+            release(head);
+            throw;
+        }
+    }
+
+    /**
+     * Copy constructor - O(1) snapshot sharing every node
+     */
+    PersistentList(const PersistentList& other) : head(acquire(other.head)), size(other.size) {}
+
+    PersistentList(PersistentList&& other) noexcept : head(other.head), size(other.size) {
+        other.head = nullptr;
+        other.size = 0;
+    }
+
+    /**
+     * Assignment operator - O(1) plus freeing nodes no other version uses
+     */
+    PersistentList& operator=(const PersistentList& other) {
+        const Node* previous = head;
+        head = acquire(other.head);
+        size = other.size;
+        release(previous);
+        return *this;
+    }
+
+    PersistentList& operator=(PersistentList&& other) noexcept {
+        if (this != &other) {
+            release(head);
+            head = other.head;
+            size = other.size;
+            other.head = nullptr;
+            other.size = 0;
+        }
+        return *this;
+    }
+
+    /**
+     * Destructor - Drop this version's reference
+     */
+    ~PersistentList() {
+        release(head);
+    }
+
+    /**
+     * New version with value in front of this one (this version is unchanged)
+     */
+    PersistentList pushFront(const T& value) const {
+        return emplaceFront(value);
+    }
+
+    PersistentList pushFront(T&& value) const {
+        return emplaceFront(std::move(value));
+    }
+
+    /**
+     * New version with an element constructed in place in front of this one
+     * @param args Arguments forwarded to T's constructor
+     */
+    template <typename... Args>
+    PersistentList emplaceFront(Args&&... args) const {
+        const Node* successor = acquire(head);
+        try {
+            return PersistentList(new Node(successor, std::forward<Args>(args)...), size + 1);
+        } catch (...) {
+            release(successor);
+            throw;
+        }
+    }
+
+    /**
+     * New version without the first element (shares the rest)
+     * @throws std::underflow_error if list is empty
+     */
+    PersistentList popFront() const {
+        if (isEmpty()) {
+            throw std::underflow_error("List is empty");
+        }
+        return PersistentList(acquire(head->next), size - 1);
+    }
+
+    /**
+     * New version without the first count elements (shares the rest)
+     * @throws std::out_of_range if count exceeds the size
+     */
+    PersistentList drop(size_t count) const {
+        if (count > size) {
+            throw std::out_of_range("Index out of range");
+        }
+        const Node* current = head;
+        for (size_t i = 0; i < count; ++i) {
+            current = current->next;
+        }
+        return PersistentList(acquire(current), size - count);
+    }
+
+    /**
+     * New version with the elements in reverse order (copies every element)
+     */
+    PersistentList reverse() const {
+        PersistentList result;
+        for (const Node* current = head; current != nullptr; current = current->next) {
+            result = result.pushFront(current->data);
+        }
+        return result;
+    }
+
+    /**
+     * Get first element
+     * @throws std::underflow_error if list is empty
+     */
+    const T& front() const {
+        if (isEmpty()) {
+            throw std::underflow_error("List is empty");
+        }
+        return head->data;
+    }
+
+    /**
+     * Get element at specific index
+     * @throws std::out_of_range if index is invalid
+     */
+    const T& at(size_t index) const {
+        if (index >= size) {
+            throw std::out_of_range("Index out of range");
+        }
+        const Node* current = head;
+        for (size_t i = 0; i < index; ++i) {
+            current = current->next;
+        }
+        return current->data;
+    }
+
+    const T& operator[](size_t index) const {
+        return at(index);
+    }
+
+    /**
+     * Find index of first occurrence of value
+     * @return Index of value, or -1 if not found
+     */
+    int find(const T& value) const {
+        int index = 0;
+        for (const Node* current = head; current != nullptr; current = current->next) {
+            if (current->data == value) {
+                return index;
+            }
+            index++;
+        }
+        return -1;
+    }
+
+    /**
+     * Check if value exists in the list
+     */
+    bool contains(const T& value) const {
+        return find(value) != -1;
+    }
+
+    /**
+     * Check if list is empty
+     */
+    bool isEmpty() const {
+        return size == 0;
+    }
+
+    /**
+     * Get number of elements in this version
+     */
+    size_t getSize() const {
+        return size;
+    }
+
+    /**
+     * Check whether two versions start at the same node (same contents, O(1))
+     */
+    bool sharesHeadWith(const PersistentList& other) const {
+        return head == other.head;
+    }
+
+    /**
+     * Copy this version's elements into a vector, front first
+     */
+    std::vector<T> toVector() const {
+        return std::vector<T>(begin(), end());
+    }
+
+    /**
+     * Display list contents (for debugging)
+     */
+    void display() const {
+        if (isEmpty()) {
+            std::cout << "List is empty" << std::endl;
+            return;
+        }
+
+        std::cout << "List: ";
+        for (const Node* current = head; current != nullptr; current = current->next) {
+            std::cout << current->data;
+            if (current->next != nullptr) {
+                std::cout << " -> ";
+            }
+        }
+        std::cout << " (size: " << size << ")" << std::endl;
+    }
+
+    iterator begin() const {
+        return iterator(head);
+    }
+
+    iterator end() const {
+        return iterator(nullptr);
+    }
+
+    iterator cbegin() const {
+        return begin();
+    }
+
+    iterator cend() const {
+        return end();
+    }
+};
+
+#endif // PERSISTENT_LIST_H
@@ -0,0 +1,566 @@
+#ifndef ROARING_BITMAP_H
+#define ROARING_BITMAP_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <iostream>
+#include <initializer_list>
+#include "../algorithms/binary_search.h"
+
+/**
+ * Roaring Bitmap - compressed sorted set of 32-bit integers
+ *
+ * Time Complexity:
+ * - Contains: O(log c + log 4096) - directory search, then container lookup
+ * - Add / Remove: O(log c + 4096) worst case (array container shift)
+ * - Intersect / Union: O(c * 1024) word operations at most, often far less
+ * - Cardinality: O(c)
+ *
+ * Space Complexity: about 2 bytes per value for sparse data, 1 bit per
+ * value for dense data, and 4 bytes per run for consecutive values
+ *
+ * Values are split into a 16-bit high part (the chunk key) and a 16-bit
+ * low part. The chunk keys form a sorted directory that is binary searched;
+ * each chunk's low parts live in the cheapest of three containers:
+ * - Array container: sorted uint16_t values, for chunks with <= 4096 values
+ * - Bitmap container: 65536 bits (1024 words), for denser chunks
+ * - Run container: (start, length) pairs, produced by runOptimize()
+ * Bitmap algebra is done 64 bits at a time in loops the compiler vectorizes.
+ * Intersecting a small array with a much larger one gallops through the
+ * larger array from the previous match instead of merging.
+ */
+class RoaringBitmap {
+private:
+    static constexpr size_t ARRAY_MAX = 4096;       // Larger arrays become bitmaps
+    static constexpr size_t BITMAP_WORDS = 1024;    // 65536 bits
+
+    /**
+     * Values of one 65536-wide chunk
+     */
+    struct Container {
+        enum class Type { Array, Bitmap, Run };
+
+        Type type = Type::Array;
+        std::vector<uint16_t> array;                          // Sorted low parts
+        std::vector<uint64_t> bitmap;                         // BITMAP_WORDS words
+        std::vector<std::pair<uint16_t, uint16_t>> runs;      // (start, length - 1)
+        uint32_t cardinality = 0;
+
+        bool contains(uint16_t low) const {
+            switch (type) {
+                case Type::Array: {
+                    size_t index = BinarySearch::branchlessLowerBound(array.data(), array.size(), low);
+                    return index < array.size() && array[index] == low;
+                }
+                case Type::Bitmap:
+                    return (bitmap[low >> 6] >> (low & 63)) & 1;
+                case Type::Run: {
+                    // Last run starting at or before low
+                    auto it = std::upper_bound(runs.begin(), runs.end(), low,
+                        [](uint16_t value, const std::pair<uint16_t, uint16_t>& run) { return value < run.first; });
+                    if (it == runs.begin()) return false;
+                    --it;
+                    return static_cast<uint32_t>(low) <= static_cast<uint32_t>(it->first) + it->second;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @return true if the value was not present before
+         */
+        bool add(uint16_t low) {
+            if (type == Type::Run) toNatural();
+
+            if (type == Type::Bitmap) {
+                uint64_t mask = uint64_t(1) << (low & 63);
+                if (bitmap[low >> 6] & mask) return false;
+                bitmap[low >> 6] |= mask;
+                cardinality++;
+                return true;
+            }
+
+            size_t index = BinarySearch::branchlessLowerBound(array.data(), array.size(), low);
+            if (index < array.size() && array[index] == low) return false;
+            array.insert(array.begin() + index, low);
+            cardinality++;
+            if (array.size() > ARRAY_MAX) toBitmap();
+            return true;
+        }
+
+        /**
+         * @return true if the value was present
+         */
+        bool remove(uint16_t low) {
+            if (type == Type::Run) toNatural();
+
+            if (type == Type::Bitmap) {
+                uint64_t mask = uint64_t(1) << (low & 63);
+                if (!(bitmap[low >> 6] & mask)) return false;
+                bitmap[low >> 6] &= ~mask;
+                cardinality--;
+                if (cardinality <= ARRAY_MAX) toArray();
+                return true;
+            }
+
+            size_t index = BinarySearch::branchlessLowerBound(array.data(), array.size(), low);
+            if (index == array.size() || array[index] != low) return false;
+            array.erase(array.begin() + index);
+            cardinality--;
+            return true;
+        }
+
+        template <typename F>
+        void forEach(F fn) const {
+            switch (type) {
+                case Type::Array:
+                    for (uint16_t low : array) fn(low);
+                    break;
+                case Type::Bitmap:
+                    for (size_t w = 0; w < BITMAP_WORDS; ++w) {
+                        uint64_t word = bitmap[w];
+                        while (word != 0) {
+                            fn(static_cast<uint16_t>(w * 64 + countTrailingZeros(word)));
+                            word &= word - 1;
+                        }
+                    }
+                    break;
+                case Type::Run:
+                    for (const auto& run : runs) {
+                        for (uint32_t v = run.first; v <= static_cast<uint32_t>(run.first) + run.second; ++v) {
+                            fn(static_cast<uint16_t>(v));
+                        }
+                    }
+                    break;
+            }
+        }
+
+        void toBitmap() {
+            std::vector<uint64_t> words(BITMAP_WORDS, 0);
+            forEach([&](uint16_t low) { words[low >> 6] |= uint64_t(1) << (low & 63); });
+            bitmap = std::move(words);
+            array.clear();
+            array.shrink_to_fit();
+            runs.clear();
+            type = Type::Bitmap;
+        }
+
+        void toArray() {
+            std::vector<uint16_t> values;
+            values.reserve(cardinality);
+            forEach([&](uint16_t low) { values.push_back(low); });
+            array = std::move(values);
+            bitmap.clear();
+            bitmap.shrink_to_fit();
+            runs.clear();
+            type = Type::Array;
+        }
+
+        /**
+         * Array or bitmap, whichever suits the cardinality
+         */
+        void toNatural() {
+            if (cardinality > ARRAY_MAX) {
+                if (type != Type::Bitmap) toBitmap();
+            } else if (type != Type::Array) {
+                toArray();
+            }
+        }
+
+        /**
+         * Switch to a run container if that is the smallest representation
+         */
+        void runOptimize() {
+            std::vector<std::pair<uint16_t, uint16_t>> found;
+            forEach([&](uint16_t low) {
+                if (!found.empty() && static_cast<uint32_t>(found.back().first) + found.back().second + 1 == low) {
+                    found.back().second++;
+                } else {
+                    found.push_back({low, 0});
+                }
+            });
+
+            size_t runBytes = found.size() * 4;
+            size_t naturalBytes = cardinality > ARRAY_MAX ? BITMAP_WORDS * 8 : cardinality * 2;
+            if (runBytes < naturalBytes) {
+                runs = std::move(found);
+                array.clear();
+                array.shrink_to_fit();
+                bitmap.clear();
+                bitmap.shrink_to_fit();
+                type = Type::Run;
+            } else {
+                toNatural();
+            }
+        }
+
+        size_t sizeInBytes() const {
+            return array.size() * 2 + bitmap.size() * 8 + runs.size() * 4;
+        }
+    };
+
+    std::vector<uint16_t> keys;            // Sorted chunk keys (high 16 bits)
+    std::vector<Container> containers;     // containers[i] holds chunk keys[i]
+
+public:
+    /**
+     * Constructor - Initialize empty set
+     */
+    RoaringBitmap() = default;
+
+    /**
+     * Constructor with initializer list
+     */
+    RoaringBitmap(std::initializer_list<uint32_t> init) {
+        for (uint32_t value : init) add(value);
+    }
+
+    /**
+     * Build from a sorted vector of IDs (duplicates allowed)
+     * @param sorted Values in ascending order
+     */
+    static RoaringBitmap fromSorted(const std::vector<uint32_t>& sorted) {
+        RoaringBitmap result;
+        for (size_t i = 0; i < sorted.size();) {
+            uint16_t high = static_cast<uint16_t>(sorted[i] >> 16);
+            Container c;
+            while (i < sorted.size() && (sorted[i] >> 16) == high) {
+                uint16_t low = static_cast<uint16_t>(sorted[i]);
+                if (c.array.empty() || c.array.back() != low) c.array.push_back(low);
+                i++;
+            }
+            c.cardinality = static_cast<uint32_t>(c.array.size());
+            if (c.cardinality > ARRAY_MAX) c.toBitmap();
+            result.keys.push_back(high);
+            result.containers.push_back(std::move(c));
+        }
+        return result;
+    }
+
+    /**
+     * Add a value
+     * @return true if the value was not already present
+     */
+    bool add(uint32_t value) {
+        uint16_t high = static_cast<uint16_t>(value >> 16);
+        size_t index = BinarySearch::branchlessLowerBound(keys.data(), keys.size(), high);
+        if (index == keys.size() || keys[index] != high) {
+            keys.insert(keys.begin() + index, high);
+            containers.insert(containers.begin() + index, Container());
+        }
+        return containers[index].add(static_cast<uint16_t>(value));
+    }
+
+    /**
+     * Remove a value
+     * @return true if the value was present
+     */
+    bool remove(uint32_t value) {
+        int index = findChunk(static_cast<uint16_t>(value >> 16));
+        if (index == -1) return false;
+
+        bool removed = containers[index].remove(static_cast<uint16_t>(value));
+        if (containers[index].cardinality == 0) {
+            keys.erase(keys.begin() + index);
+            containers.erase(containers.begin() + index);
+        }
+        return removed;
+    }
+
+    /**
+     * Check if a value is present
+     */
+    bool contains(uint32_t value) const {
+        int index = findChunk(static_cast<uint16_t>(value >> 16));
+        return index != -1 && containers[index].contains(static_cast<uint16_t>(value));
+    }
+
+    /**
+     * Set intersection
+     */
+    RoaringBitmap operator&(const RoaringBitmap& other) const {
+        RoaringBitmap result;
+        size_t i = 0, j = 0;
+        while (i < keys.size() && j < other.keys.size()) {
+            if (keys[i] < other.keys[j]) {
+                i++;
+            } else if (other.keys[j] < keys[i]) {
+                j++;
+            } else {
+                Container c = intersect(containers[i], other.containers[j]);
+                if (c.cardinality != 0) {
+                    result.keys.push_back(keys[i]);
+                    result.containers.push_back(std::move(c));
+                }
+                i++;
+                j++;
+            }
+        }
+        return result;
+    }
+
+    /**
+     * Set union
+     */
+    RoaringBitmap operator|(const RoaringBitmap& other) const {
+        RoaringBitmap result;
+        size_t i = 0, j = 0;
+        while (i < keys.size() || j < other.keys.size()) {
+            if (j == other.keys.size() || (i < keys.size() && keys[i] < other.keys[j])) {
+                result.keys.push_back(keys[i]);
+                result.containers.push_back(containers[i++]);
+            } else if (i == keys.size() || other.keys[j] < keys[i]) {
+                result.keys.push_back(other.keys[j]);
+                result.containers.push_back(other.containers[j++]);
+            } else {
+                result.keys.push_back(keys[i]);
+                result.containers.push_back(unite(containers[i++], other.containers[j++]));
+            }
+        }
+        return result;
+    }
+
+    RoaringBitmap& operator&=(const RoaringBitmap& other) {
+        return *this = *this & other;
+    }
+
+    RoaringBitmap& operator|=(const RoaringBitmap& other) {
+        return *this = *this | other;
+    }
+
+    bool operator==(const RoaringBitmap& other) const {
+        return toVector() == other.toVector();
+    }
+
+    bool operator!=(const RoaringBitmap& other) const {
+        return !(*this == other);
+    }
+
+    /**
+     * Convert chunks with long runs of consecutive values to run containers
+     */
+    void runOptimize() {
+        for (auto& c : containers) c.runOptimize();
+    }
+
+    /**
+     * Get number of values in the set
+     */
+    size_t getCardinality() const {
+        size_t total = 0;
+        for (const auto& c : containers) total += c.cardinality;
+        return total;
+    }
+
+    /**
+     * Check if set is empty
+     */
+    bool isEmpty() const {
+        return keys.empty();
+    }
+
+    /**
+     * Remove all values
+     */
+    void clear() {
+        keys.clear();
+        containers.clear();
+    }
+
+    /**
+     * Approximate heap memory used by container payloads
+     */
+    size_t sizeInBytes() const {
+        size_t total = keys.size() * (sizeof(uint16_t) + sizeof(Container));
+        for (const auto& c : containers) total += c.sizeInBytes();
+        return total;
+    }
+
+    /**
+     * Call fn(value) for every value in ascending order
+     */
+    template <typename F>
+    void forEach(F fn) const {
+        for (size_t i = 0; i < keys.size(); ++i) {
+            uint32_t base = static_cast<uint32_t>(keys[i]) << 16;
+            containers[i].forEach([&](uint16_t low) { fn(base | low); });
+        }
+    }
+
+    /**
+     * All values in ascending order
+     */
+    std::vector<uint32_t> toVector() const {
+        std::vector<uint32_t> result;
+        result.reserve(getCardinality());
+        forEach([&](uint32_t value) { result.push_back(value); });
+        return result;
+    }
+
+    /**
+     * Display set contents (for debugging)
+     */
+    void display() const {
+        if (isEmpty()) {
+            std::cout << "Set is empty" << std::endl;
+            return;
+        }
+
+        std::cout << "Set: {";
+        bool first = true;
+        forEach([&](uint32_t value) {
+            if (!first) std::cout << ", ";
+            std::cout << value;
+            first = false;
+        });
+        std::cout << "} (cardinality: " << getCardinality() << ", chunks: " << keys.size() << ")" << std::endl;
+    }
+
+private:
+    int findChunk(uint16_t high) const {
+        size_t index = BinarySearch::branchlessLowerBound(keys.data(), keys.size(), high);
+        return (index < keys.size() && keys[index] == high) ? static_cast<int>(index) : -1;
+    }
+
+    static size_t countTrailingZeros(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<size_t>(__builtin_ctzll(word));
+#else
+        size_t count = 0;
+        while ((word & 1) == 0) {
+            word >>= 1;
+            count++;
+        }
+        return count;
+#endif
+    }
+
+    static uint32_t popcount(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<uint32_t>(__builtin_popcountll(word));
+#else
+        uint32_t count = 0;
+        while (word != 0) {
+            word &= word - 1;
+            count++;
+        }
+        return count;
+#endif
+    }
+
+    static uint32_t countBits(const std::vector<uint64_t>& words) {
+        uint32_t total = 0;
+        for (uint64_t word : words) total += popcount(word);
+        return total;
+    }
+
+    /**
+     * Galloping (exponential) search: first index at or after from whose
+     * value is not less than target, in O(log d) for a distance d
+     */
+    static size_t gallop(const std::vector<uint16_t>& values, size_t from, uint16_t target) {
+        size_t n = values.size();
+        if (from >= n || !(values[from] < target)) return from;
+
+        // Double the step until it passes target; the answer is in (from + step/2, from + step]
+        size_t step = 1;
+        while (from + step < n && values[from + step] < target) {
+            step <<= 1;
+        }
+        size_t lo = from + step / 2 + 1;
+        size_t hi = std::min(from + step + 1, n);
+        return lo + BinarySearch::branchlessLowerBound(values.data() + lo, hi - lo, target);
+    }
+
+    /**
+     * Intersection of two chunks with the same key
+     */
+    static Container intersect(const Container& a, const Container& b) {
+        // Run containers are expanded first; keeps the kernels to three cases
+        if (a.type == Container::Type::Run || b.type == Container::Type::Run) {
+            Container x = a, y = b;
+            x.toNatural();
+            y.toNatural();
+            return intersect(x, y);
+        }
+
+        Container result;
+        if (a.type == Container::Type::Bitmap && b.type == Container::Type::Bitmap) {
+            result.bitmap.resize(BITMAP_WORDS);
+            for (size_t w = 0; w < BITMAP_WORDS; ++w) {
+                result.bitmap[w] = a.bitmap[w] & b.bitmap[w];
+            }
+            result.type = Container::Type::Bitmap;
+            result.cardinality = countBits(result.bitmap);
+            if (result.cardinality <= ARRAY_MAX) result.toArray();
+        } else if (a.type == Container::Type::Array && b.type == Container::Type::Array) {
+            const auto& small = a.array.size() <= b.array.size() ? a.array : b.array;
+            const auto& large = a.array.size() <= b.array.size() ? b.array : a.array;
+            if (small.size() * 32 < large.size()) {
+                // Very different sizes: gallop through large from the previous match
+                size_t from = 0;
+                for (uint16_t low : small) {
+                    from = gallop(large, from, low);
+                    if (from == large.size()) break;
+                    if (large[from] == low) result.array.push_back(low);
+                }
+            } else {
+                std::set_intersection(small.begin(), small.end(), large.begin(), large.end(),
+                                      std::back_inserter(result.array));
+            }
+            result.cardinality = static_cast<uint32_t>(result.array.size());
+        } else {
+            const Container& arr = a.type == Container::Type::Array ? a : b;
+            const Container& bits = a.type == Container::Type::Array ? b : a;
+            for (uint16_t low : arr.array) {
+                if ((bits.bitmap[low >> 6] >> (low & 63)) & 1) result.array.push_back(low);
+            }
+            result.cardinality = static_cast<uint32_t>(result.array.size());
+        }
+        return result;
+    }
+
+    /**
+     * Union of two chunks with the same key
+     */
+    static Container unite(const Container& a, const Container& b) {
+        if (a.type == Container::Type::Run || b.type == Container::Type::Run) {
+            Container x = a, y = b;
+            x.toNatural();
+            y.toNatural();
+            return unite(x, y);
+        }
+
+        Container result;
+        if (a.type == Container::Type::Array && b.type == Container::Type::Array) {
+            std::set_union(a.array.begin(), a.array.end(), b.array.begin(), b.array.end(),
+                           std::back_inserter(result.array));
+            result.cardinality = static_cast<uint32_t>(result.array.size());
+            if (result.cardinality > ARRAY_MAX) result.toBitmap();
+            return result;
+        }
+
+        result.type = Container::Type::Bitmap;
+        if (a.type == Container::Type::Bitmap && b.type == Container::Type::Bitmap) {
+            result.bitmap.resize(BITMAP_WORDS);
+            for (size_t w = 0; w < BITMAP_WORDS; ++w) {
+                result.bitmap[w] = a.bitmap[w] | b.bitmap[w];
+            }
+        } else {
+            const Container& arr = a.type == Container::Type::Array ? a : b;
+            const Container& bits = a.type == Container::Type::Array ? b : a;
+            result.bitmap = bits.bitmap;
+            for (uint16_t low : arr.array) {
+                result.bitmap[low >> 6] |= uint64_t(1) << (low & 63);
+            }
+        }
+        result.cardinality = countBits(result.bitmap);
+        return result;
+    }
+};
+
+#endif // ROARING_BITMAP_H
@@ -0,0 +1,722 @@
+#ifndef SKIP_LIST_H
+#define SKIP_LIST_H
+
+#include <new>
+#include <memory>
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+#include <iterator>
+#include <functional>
+#include <type_traits>
+#include <iostream>
+#include <stdexcept>
+#include <initializer_list>
+#include "node_pool.h"
+
+/**
+ * Skip List Implementation in C++ (span-counted, Redis zset style)
+ *
+ * Time Complexity (expected):
+ * - Access by index: O(log n)
+ * - Insert / delete at index: O(log n)
+ * - Insert / delete / find by value (Ordered mode): O(log n)
+ * - Lower / upper bound (Ordered mode): O(log n)
+ * - Range scan (Ordered mode): O(log n + k) for k reported elements
+ * - Push / pop at either end: O(log n)
+ * - Find by value (Indexed mode): O(n)
+ *
+ * Space Complexity: O(n) - on average 4/3 links per element with p = 1/4
+ *
+ * Every node has a random height; the link at level l skips to the next
+ * node that is at least l + 1 high and records its span, the number of
+ * level-0 steps it covers. Summing spans along a search path gives the
+ * index of every visited node, so positional operations run in
+ * O(log n) even though the structure is linked.
+ *
+ * Two modes share the implementation:
+ * - Ordered (default): elements are kept sorted by Compare (duplicates
+ *   allowed); insert(value), find, lowerBound, upperBound and rangeScan
+ *   use the order, at(i) is the i-th smallest element.
+ * - Indexed: a sequence like LinkedList; pushFront, pushBack and
+ *   insert(index, value) place elements by position.
+ *
+ * A node stores its links right after its value. Nodes of each height
+ * come from their own NodePool, so node memory lives in cache-line-aligned
+ * slabs rather than in one heap block per node.
+ */
+template <typename T, bool Ordered = true, typename Compare = std::less<T>>
+class SkipList {
+public:
+    static constexpr size_t MAX_LEVEL = 32;
+
+private:
+    struct Node;
+
+    /**
+     * Forward link at one level
+     */
+    struct Link {
+        Node* next;
+        size_t span;    // Level-0 steps to next (to the end when next is null)
+    };
+
+    /**
+     * Node header; height links follow at LINKS_OFFSET
+     */
+    struct Node {
+        T data;
+        size_t height;
+
+        template <typename... Args>
+        explicit Node(size_t h, Args&&... args) : data(std::forward<Args>(args)...), height(h) {}
+    };
+
+    static constexpr size_t LINKS_OFFSET = (sizeof(Node) + alignof(Link) - 1) / alignof(Link) * alignof(Link);
+    static constexpr size_t NODE_ALIGN = alignof(Node) > alignof(Link) ? alignof(Node) : alignof(Link);
+
+    Link head[MAX_LEVEL];   // Header links (the header holds no value)
+    size_t level;           // Number of levels in use (at least 1)
+    Node* tail;             // Last node
+    size_t size;            // Current number of elements
+    uint64_t rngState;      // xorshift state for node heights
+    Compare compare;
+    std::vector<std::unique_ptr<NodePool>> pools;   // pools[h - 1] serves nodes of height h
+
+public:
+    /**
+     * Forward iterator over elements in list order
+     * Ordered lists only hand out const access so keys cannot be changed in place
+     */
+    template <bool IsConst>
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+
+        Iterator() : node(nullptr) {}
+
+        template <bool WasConst, typename = std::enable_if_t<IsConst && !WasConst>>
+        Iterator(const Iterator<WasConst>& other) : node(other.node) {}
+
+        reference operator*() const {
+            return node->data;
+        }
+
+        pointer operator->() const {
+            return &node->data;
+        }
+
+        Iterator& operator++() {
+            node = linksOf(node)[0].next;
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        friend bool operator==(const Iterator& a, const Iterator& b) {
+            return a.node == b.node;
+        }
+
+        friend bool operator!=(const Iterator& a, const Iterator& b) {
+            return a.node != b.node;
+        }
+
+    private:
+        friend class SkipList;
+
+        Node* node;
+
+        explicit Iterator(Node* n) : node(n) {}
+    };
+
+    using iterator = Iterator<Ordered>;
+    using const_iterator = Iterator<true>;
+    using reference = std::conditional_t<Ordered, const T&, T&>;
+
+    /**
+     * Constructor - Initialize empty skip list
+     * @param comp Ordering used in Ordered mode
+     * @param seed Seed for node heights (fixed by default for reproducible layouts)
+     */
+    explicit SkipList(const Compare& comp = Compare(), uint64_t seed = 0x9E3779B97F4A7C15ULL)
+        : level(1), tail(nullptr), size(0), rngState(seed != 0 ? seed : 1), compare(comp), pools(MAX_LEVEL) {
+        resetHead();
+    }
+
+    /**
+     * Constructor with initializer list (sorted in Ordered mode, kept in order otherwise)
+     */
+    SkipList(std::initializer_list<T> init) : SkipList() {
+        for (const auto& item : init) {
+            add(item);
+        }
+    }
+
+    /**
+     * Copy constructor
+     */
+    SkipList(const SkipList& other) : SkipList(other.compare, other.rngState) {
+        copyFrom(other);
+    }
+
+    /**
+     * Assignment operator
+     */
+    SkipList& operator=(const SkipList& other) {
+        if (this != &other) {
+            clear();
+            compare = other.compare;
+            copyFrom(other);
+        }
+        return *this;
+    }
+
+    /**
+     * Destructor - Clean up all nodes
+     */
+    ~SkipList() {
+        clear();
+    }
+
+    // Ordered mode
+
+    /**
+     * Insert value at its sorted position (after equal elements)
+     * @return Index the value was inserted at
+     */
+    template <bool O = Ordered, typename = std::enable_if_t<O>>
+    size_t insert(const T& value) {
+        Node* update[MAX_LEVEL];
+        size_t rank[MAX_LEVEL];
+        findPath([&](Node* next, size_t) { return !compare(value, next->data); }, update, rank);
+        linkNode(createNode(randomHeight(), value), update, rank);
+        return rank[0];
+    }
+
+    /**
+     * Remove first occurrence of value
+     * @return true if element was found and removed, false otherwise
+     */
+    bool remove(const T& value) {
+        if constexpr (Ordered) {
+            Node* update[MAX_LEVEL];
+            size_t rank[MAX_LEVEL];
+            findPath([&](Node* next, size_t) { return compare(next->data, value); }, update, rank);
+            Node* candidate = links(update[0])[0].next;
+            if (candidate == nullptr || compare(value, candidate->data)) {
+                return false;
+            }
+            unlinkNode(candidate, update);
+            destroyNode(candidate);
+            return true;
+        } else {
+            int index = find(value);
+            if (index < 0) {
+                return false;
+            }
+            removeAt(static_cast<size_t>(index));
+            return true;
+        }
+    }
+
+    /**
+     * Iterator to the first element not ordered before value
+     */
+    template <bool O = Ordered, typename = std::enable_if_t<O>>
+    const_iterator lowerBound(const T& value) const {
+        return const_iterator(boundNode(value, false));
+    }
+
+    /**
+     * Iterator to the first element ordered after value
+     */
+    template <bool O = Ordered, typename = std::enable_if_t<O>>
+    const_iterator upperBound(const T& value) const {
+        return const_iterator(boundNode(value, true));
+    }
+
+    /**
+     * Number of elements ordered before value (index of lowerBound)
+     */
+    template <bool O = Ordered, typename = std::enable_if_t<O>>
+    size_t lowerBoundIndex(const T& value) const {
+        Node* current = nullptr;
+        size_t position = 0;
+        for (size_t l = level; l-- > 0;) {
+            while (links(current)[l].next != nullptr && compare(links(current)[l].next->data, value)) {
+                position += links(current)[l].span;
+                current = links(current)[l].next;
+            }
+        }
+        return position;
+    }
+
+    /**
+     * Visit every element in [low, high) in order
+     * @param visit Called with each element (const T&)
+     */
+    template <typename Func, bool O = Ordered, typename = std::enable_if_t<O>>
+    void rangeScan(const T& low, const T& high, Func visit) const {
+        for (Node* current = boundNode(low, false);
+             current != nullptr && compare(current->data, high);
+             current = links(current)[0].next) {
+            visit(current->data);
+        }
+    }
+
+    // Indexed mode
+
+    /**
+     * Add element to the front of the list
+     */
+    template <bool O = Ordered, typename = std::enable_if_t<!O>>
+    void pushFront(const T& value) {
+        insertAt(0, value);
+    }
+
+    /**
+     * Add element to the back of the list
+     */
+    template <bool O = Ordered, typename = std::enable_if_t<!O>>
+    void pushBack(const T& value) {
+        insertAt(size, value);
+    }
+
+    /**
+     * Insert element at specific index
+     * @throws std::out_of_range if index is invalid
+     */
+    template <bool O = Ordered, typename = std::enable_if_t<!O>>
+    void insert(size_t index, const T& value) {
+        if (index > size) {
+            throw std::out_of_range("Index out of range");
+        }
+        insertAt(index, value);
+    }
+
+    // Both modes
+
+    /**
+     * Remove element from the front of the list
+     * @throws std::underflow_error if list is empty
+     */
+    T popFront() {
+        if (isEmpty()) {
+            throw std::underflow_error("List is empty");
+        }
+        return removeAt(0);
+    }
+
+    /**
+     * Remove element from the back of the list
+     * @throws std::underflow_error if list is empty
+     */
+    T popBack() {
+        if (isEmpty()) {
+            throw std::underflow_error("List is empty");
+        }
+        return removeAt(size - 1);
+    }
+
+    /**
+     * Remove element at specific index
+     * @return The removed element
+     * @throws std::out_of_range if index is invalid
+     */
+    T removeAt(size_t index) {
+        if (index >= size) {
+            throw std::out_of_range("Index out of range");
+        }
+
+        Node* update[MAX_LEVEL];
+        size_t rank[MAX_LEVEL];
+        findPath([&](Node*, size_t reached) { return reached <= index; }, update, rank);
+
+        Node* node = links(update[0])[0].next;
+        unlinkNode(node, update);
+        T value = std::move(node->data);
+        destroyNode(node);
+        return value;
+    }
+
+    /**
+     * Get element at specific index
+     * @throws std::out_of_range if index is invalid
+     */
+    reference at(size_t index) {
+        if (index >= size) {
+            throw std::out_of_range("Index out of range");
+        }
+        return nodeAt(index)->data;
+    }
+
+    const T& at(size_t index) const {
+        if (index >= size) {
+            throw std::out_of_range("Index out of range");
+        }
+        return nodeAt(index)->data;
+    }
+
+    reference operator[](size_t index) {
+        return at(index);
+    }
+
+    const T& operator[](size_t index) const {
+        return at(index);
+    }
+
+    /**
+     * Get first element
+     * @throws std::underflow_error if list is empty
+     */
+    const T& front() const {
+        if (isEmpty()) {
+            throw std::underflow_error("List is empty");
+        }
+        return head[0].next->data;
+    }
+
+    /**
+     * Get last element
+     * @throws std::underflow_error if list is empty
+     */
+    const T& back() const {
+        if (isEmpty()) {
+            throw std::underflow_error("List is empty");
+        }
+        return tail->data;
+    }
+
+    /**
+     * Find index of first occurrence of value
+     * O(log n) in Ordered mode, O(n) in Indexed mode
+     * @return Index of value, or -1 if not found
+     */
+    int find(const T& value) const {
+        if constexpr (Ordered) {
+            size_t index = lowerBoundIndex(value);
+            if (index < size && !compare(value, nodeAt(index)->data)) {
+                return static_cast<int>(index);
+            }
+            return -1;
+        } else {
+            int index = 0;
+            for (Node* current = head[0].next; current != nullptr; current = links(current)[0].next) {
+                if (current->data == value) {
+                    return index;
+                }
+                index++;
+            }
+            return -1;
+        }
+    }
+
+    /**
+     * Check if value exists in the list
+     */
+    bool contains(const T& value) const {
+        return find(value) != -1;
+    }
+
+    /**
+     * Check if list is empty
+     */
+    bool isEmpty() const {
+        return size == 0;
+    }
+
+    /**
+     * Get current size of list
+     */
+    size_t getSize() const {
+        return size;
+    }
+
+    /**
+     * Get number of levels currently in use
+     */
+    size_t getLevel() const {
+        return level;
+    }
+
+    /**
+     * Clear all elements and return node memory to the system
+     */
+    void clear() {
+        Node* current = head[0].next;
+        while (current != nullptr) {
+            Node* next = links(current)[0].next;
+            destroyNode(current);
+            current = next;
+        }
+        for (auto& pool : pools) {
+            pool.reset();
+        }
+        resetHead();
+    }
+
+    /**
+     * Display list contents (for debugging)
+     */
+    void display() const {
+        if (isEmpty()) {
+            std::cout << "List is empty" << std::endl;
+            return;
+        }
+
+        std::cout << "List: ";
+        for (Node* current = head[0].next; current != nullptr; current = links(current)[0].next) {
+            std::cout << current->data;
+            if (links(current)[0].next != nullptr) {
+                std::cout << " -> ";
+            }
+        }
+        std::cout << " (size: " << size << ", levels: " << level << ")" << std::endl;
+    }
+
+    iterator begin() {
+        return iterator(head[0].next);
+    }
+
+    iterator end() {
+        return iterator(nullptr);
+    }
+
+    const_iterator begin() const {
+        return const_iterator(head[0].next);
+    }
+
+    const_iterator end() const {
+        return const_iterator(nullptr);
+    }
+
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    const_iterator cend() const {
+        return end();
+    }
+
+private:
+    /**
+     * Links stored right after a node's header
+     */
+    static Link* linksOf(Node* node) {
+        return std::launder(reinterpret_cast<Link*>(reinterpret_cast<char*>(node) + LINKS_OFFSET));
+    }
+
+    /**
+     * Links of a node, or the header links for nullptr
+     */
+    Link* links(Node* node) const {
+        return node == nullptr ? const_cast<Link*>(head) : linksOf(node);
+    }
+
+    void resetHead() {
+        for (size_t l = 0; l < MAX_LEVEL; ++l) {
+            head[l].next = nullptr;
+            head[l].span = 0;
+        }
+        level = 1;
+        tail = nullptr;
+        size = 0;
+    }
+
+    /**
+     * Height with P(h) = (1/4)^(h-1) * 3/4, capped at MAX_LEVEL
+     */
+    size_t randomHeight() {
+        rngState ^= rngState << 13;
+        rngState ^= rngState >> 7;
+        rngState ^= rngState << 17;
+        uint64_t bits = rngState;
+        size_t height = 1;
+        while (height < MAX_LEVEL && (bits & 3) == 0) {
+            height++;
+            bits >>= 2;
+        }
+        return height;
+    }
+
+    /**
+     * Walk from the top level down, moving right while goRight(next, rankOfNext)
+     * holds; records the last node visited at each level (nullptr = header)
+     * and its rank (1-based index, 0 for the header)
+     */
+    template <typename Pred>
+    void findPath(Pred goRight, Node** update, size_t* rank) const {
+        Node* current = nullptr;
+        size_t position = 0;
+        for (size_t l = level; l-- > 0;) {
+            Link* currentLinks = links(current);
+            while (currentLinks[l].next != nullptr && goRight(currentLinks[l].next, position + currentLinks[l].span)) {
+                position += currentLinks[l].span;
+                current = currentLinks[l].next;
+                currentLinks = links(current);
+            }
+            update[l] = current;
+            rank[l] = position;
+        }
+    }
+
+    /**
+     * Node at 0-based index (index < size)
+     */
+    Node* nodeAt(size_t index) const {
+        Node* current = nullptr;
+        size_t position = 0;
+        size_t target = index + 1;
+        for (size_t l = level; l-- > 0;) {
+            while (links(current)[l].next != nullptr && position + links(current)[l].span <= target) {
+                position += links(current)[l].span;
+                current = links(current)[l].next;
+            }
+            if (position == target) {
+                break;
+            }
+        }
+        return current;
+    }
+
+    /**
+     * First node not ordered before value (strict = false) or ordered after it
+     */
+    Node* boundNode(const T& value, bool strict) const {
+        Node* current = nullptr;
+        for (size_t l = level; l-- > 0;) {
+            while (links(current)[l].next != nullptr &&
+                   (strict ? !compare(value, links(current)[l].next->data)
+                           : compare(links(current)[l].next->data, value))) {
+                current = links(current)[l].next;
+            }
+        }
+        return links(current)[0].next;
+    }
+
+    template <typename... Args>
+    void insertAt(size_t index, Args&&... args) {
+        Node* update[MAX_LEVEL];
+        size_t rank[MAX_LEVEL];
+        findPath([&](Node*, size_t reached) { return reached <= index; }, update, rank);
+        linkNode(createNode(randomHeight(), std::forward<Args>(args)...), update, rank);
+    }
+
+    /**
+     * Add at the natural position for the mode (sorted or at the end)
+     */
+    void add(const T& value) {
+        if constexpr (Ordered) {
+            insert(value);
+        } else {
+            insertAt(size, value);
+        }
+    }
+
+    /**
+     * Link node right after update[0], fixing spans on every level
+     */
+    void linkNode(Node* node, Node** update, size_t* rank) {
+        size_t height = node->height;
+        if (height > level) {
+            for (size_t l = level; l < height; ++l) {
+                update[l] = nullptr;
+                rank[l] = 0;
+                head[l].next = nullptr;
+                head[l].span = size;
+            }
+            level = height;
+        }
+
+        Link* nodeLinks = links(node);
+        for (size_t l = 0; l < height; ++l) {
+            Link* prevLinks = links(update[l]);
+            nodeLinks[l].next = prevLinks[l].next;
+            nodeLinks[l].span = prevLinks[l].span - (rank[0] - rank[l]);
+            prevLinks[l].next = node;
+            prevLinks[l].span = rank[0] - rank[l] + 1;
+        }
+        for (size_t l = height; l < level; ++l) {
+            links(update[l])[l].span++;
+        }
+
+        if (nodeLinks[0].next == nullptr) {
+            tail = node;
+        }
+        size++;
+    }
+
+    /**
+     * Unlink node; update[l] must be its predecessor path
+     */
+    void unlinkNode(Node* node, Node** update) {
+        Link* nodeLinks = links(node);
+        for (size_t l = 0; l < level; ++l) {
+            Link* prevLinks = links(update[l]);
+            if (prevLinks[l].next == node) {
+                prevLinks[l].span += nodeLinks[l].span - 1;
+                prevLinks[l].next = nodeLinks[l].next;
+            } else {
+                prevLinks[l].span--;
+            }
+        }
+
+        if (node == tail) {
+            tail = update[0];
+        }
+        while (level > 1 && head[level - 1].next == nullptr) {
+            level--;
+        }
+        size--;
+    }
+
+    /**
+     * Construct a node with its links in memory from the pool for its height
+     */
+    template <typename... Args>
+    Node* createNode(size_t height, Args&&... args) {
+        std::unique_ptr<NodePool>& pool = pools[height - 1];
+        if (!pool) {
+            pool = std::make_unique<NodePool>(LINKS_OFFSET + height * sizeof(Link), NODE_ALIGN);
+        }
+
+        void* memory = pool->allocate();
+        try {
+            Node* node = new (memory) Node(height, std::forward<Args>(args)...);
+            Link* nodeLinks = reinterpret_cast<Link*>(reinterpret_cast<char*>(node) + LINKS_OFFSET);
+            for (size_t l = 0; l < height; ++l) {
+                new (nodeLinks + l) Link{nullptr, 0};
+            }
+            return node;
+        } catch (...) {
+            pool->deallocate(memory);
+            throw;
+        }
+    }
+
+    void destroyNode(Node* node) {
+        size_t height = node->height;
+        node->~Node();
+        pools[height - 1]->deallocate(node);
+    }
+
+    /**
+     * Helper function to copy from another list (keeps its order)
+     */
+    void copyFrom(const SkipList& other) {
+        for (Node* current = other.head[0].next; current != nullptr; current = links(current)[0].next) {
+            insertAt(size, current->data);
+        }
+    }
+};
+
+#endif // SKIP_LIST_H
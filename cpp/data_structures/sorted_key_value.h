@@ -0,0 +1,317 @@
+#ifndef SORTED_KEY_VALUE_H
+#define SORTED_KEY_VALUE_H
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+#include <initializer_list>
+#include "../algorithms/binary_search.h"
+
+/**
+ * Sorted Key-Value Array with Structure-of-Arrays layout
+ *
+ * Time Complexity:
+ * - Build from records: O(n log n)
+ * - Find by key: O(log n), touching only key memory
+ * - Access value by index: O(1)
+ * - Insert / erase: O(n) (elements shift)
+ * - Build Eytzinger index: O(n)
+ *
+ * Space Complexity: O(n), plus O(n) for the optional Eytzinger index
+ *
+ * Searching an array of records by one field drags whole records through
+ * the cache just to compare a key. Here keys live in their own dense array
+ * and values in a parallel array, so a search only reads keys and the
+ * resulting index gives direct access to the value. An optional Eytzinger
+ * (BFS-order) copy of the keys makes the first levels of every search share
+ * the same few cache lines.
+ */
+template <typename K, typename V>
+class SortedKeyValue {
+private:
+    std::vector<K> keys;            // Sorted keys (dense)
+    std::vector<V> values;          // values[i] belongs to keys[i]
+    std::vector<K> eytzinger;       // Keys in BFS order, 1-based (slot 0 unused)
+    std::vector<size_t> eytzToSorted;  // Eytzinger slot -> sorted index
+    bool eytzingerEnabled;
+
+public:
+    /**
+     * Constructor - Initialize empty container
+     */
+    SortedKeyValue() : eytzingerEnabled(false) {}
+
+    /**
+     * Constructor - Build from unsorted key-value records
+     * Records with equal keys keep their relative order
+     * @param records Key-value pairs in any order
+     */
+    explicit SortedKeyValue(std::vector<std::pair<K, V>> records) : eytzingerEnabled(false) {
+        std::stable_sort(records.begin(), records.end(),
+                         [](const auto& a, const auto& b) { return a.first < b.first; });
+
+        keys.reserve(records.size());
+        values.reserve(records.size());
+        for (auto& record : records) {
+            keys.push_back(std::move(record.first));
+            values.push_back(std::move(record.second));
+        }
+    }
+
+    /**
+     * Constructor with initializer list
+     */
+    SortedKeyValue(std::initializer_list<std::pair<K, V>> init)
+        : SortedKeyValue(std::vector<std::pair<K, V>>(init)) {}
+
+    /**
+     * Find index of a key
+     * @param key Key to search for
+     * @return Index of first record with this key, -1 if not found
+     */
+    int find(const K& key) const {
+        size_t index = eytzingerEnabled ? eytzingerLowerBound(key)
+                                        : BinarySearch::branchlessLowerBound(keys, key);
+        if (index < keys.size() && !(key < keys[index])) {
+            return static_cast<int>(index);
+        }
+        return -1;
+    }
+
+    /**
+     * Index of first record whose key is not less than key
+     * @param key Key to find lower bound for
+     * @return Index in [0, size()]
+     */
+    size_t lowerBound(const K& key) const {
+        return eytzingerEnabled ? eytzingerLowerBound(key)
+                                : BinarySearch::branchlessLowerBound(keys, key);
+    }
+
+    /**
+     * Check if a key exists
+     */
+    bool contains(const K& key) const {
+        return find(key) != -1;
+    }
+
+    /**
+     * Get value for a key
+     * @param key Key to look up
+     * @return Reference to the value of the first record with this key
+     * @throws std::out_of_range if key is not present
+     */
+    V& at(const K& key) {
+        int index = find(key);
+        if (index == -1) {
+            throw std::out_of_range("Key not found");
+        }
+        return values[index];
+    }
+
+    /**
+     * Get value for a key (const version)
+     */
+    const V& at(const K& key) const {
+        int index = find(key);
+        if (index == -1) {
+            throw std::out_of_range("Key not found");
+        }
+        return values[index];
+    }
+
+    /**
+     * Get key at index
+     * @throws std::out_of_range if index is invalid
+     */
+    const K& keyAt(size_t index) const {
+        if (index >= keys.size()) {
+            throw std::out_of_range("Index out of range");
+        }
+        return keys[index];
+    }
+
+    /**
+     * Get value at index
+     * @throws std::out_of_range if index is invalid
+     */
+    V& valueAt(size_t index) {
+        if (index >= values.size()) {
+            throw std::out_of_range("Index out of range");
+        }
+        return values[index];
+    }
+
+    /**
+     * Get value at index (const version)
+     */
+    const V& valueAt(size_t index) const {
+        if (index >= values.size()) {
+            throw std::out_of_range("Index out of range");
+        }
+        return values[index];
+    }
+
+    /**
+     * Insert a record, keeping keys sorted (after existing equal keys)
+     * Drops the Eytzinger index, which must be rebuilt with buildEytzinger()
+     * @param key Key of the record
+     * @param value Value of the record
+     * @return Index the record was inserted at
+     */
+    size_t insert(const K& key, const V& value) {
+        size_t index = std::upper_bound(keys.begin(), keys.end(), key) - keys.begin();
+        keys.insert(keys.begin() + index, key);
+        values.insert(values.begin() + index, value);
+        dropEytzinger();
+        return index;
+    }
+
+    /**
+     * Remove the record at index
+     * Drops the Eytzinger index, which must be rebuilt with buildEytzinger()
+     * @throws std::out_of_range if index is invalid
+     */
+    void eraseAt(size_t index) {
+        if (index >= keys.size()) {
+            throw std::out_of_range("Index out of range");
+        }
+        keys.erase(keys.begin() + index);
+        values.erase(values.begin() + index);
+        dropEytzinger();
+    }
+
+    /**
+     * Remove the first record with a key
+     * @return true if a record was removed, false otherwise
+     */
+    bool erase(const K& key) {
+        int index = find(key);
+        if (index == -1) {
+            return false;
+        }
+        eraseAt(index);
+        return true;
+    }
+
+    /**
+     * Build the Eytzinger (BFS-order) key index used by subsequent searches
+     */
+    void buildEytzinger() {
+        eytzinger.assign(keys.size() + 1, K());
+        eytzToSorted.assign(keys.size() + 1, 0);
+        size_t next = 0;
+        fillEytzinger(1, next);
+        eytzingerEnabled = true;
+    }
+
+    /**
+     * Check if searches use the Eytzinger index
+     */
+    bool hasEytzinger() const {
+        return eytzingerEnabled;
+    }
+
+    /**
+     * Dense sorted key array (for scans or external search kernels)
+     */
+    const std::vector<K>& getKeys() const {
+        return keys;
+    }
+
+    /**
+     * Values, parallel to getKeys()
+     */
+    const std::vector<V>& getValues() const {
+        return values;
+    }
+
+    /**
+     * Check if container is empty
+     */
+    bool isEmpty() const {
+        return keys.empty();
+    }
+
+    /**
+     * Get number of records
+     */
+    size_t getSize() const {
+        return keys.size();
+    }
+
+    /**
+     * Remove all records
+     */
+    void clear() {
+        keys.clear();
+        values.clear();
+        dropEytzinger();
+    }
+
+    /**
+     * Display contents (for debugging)
+     */
+    void display() const {
+        if (isEmpty()) {
+            std::cout << "Container is empty" << std::endl;
+            return;
+        }
+
+        std::cout << "Records: ";
+        for (size_t i = 0; i < keys.size(); ++i) {
+            std::cout << keys[i] << "=" << values[i];
+            if (i + 1 < keys.size()) std::cout << ", ";
+        }
+        std::cout << " (size: " << keys.size() << ")" << std::endl;
+    }
+
+private:
+    /**
+     * In-order walk of the implicit tree assigns sorted keys to BFS slots
+     */
+    void fillEytzinger(size_t slot, size_t& next) {
+        if (slot > keys.size()) return;
+        fillEytzinger(2 * slot, next);
+        eytzinger[slot] = keys[next];
+        eytzToSorted[slot] = next;
+        next++;
+        fillEytzinger(2 * slot + 1, next);
+    }
+
+    /**
+     * Branchless descent of the Eytzinger tree
+     * @return Sorted index of first key >= key, size() if none
+     */
+    size_t eytzingerLowerBound(const K& key) const {
+        size_t n = keys.size();
+        size_t slot = 1;
+        while (slot <= n) {
+            slot = 2 * slot + (eytzinger[slot] < key);
+        }
+
+        // Undo the trailing right turns (and the final left turn) to reach
+        // the last node where the descent went left
+        slot >>= countTrailingOnes(slot) + 1;
+        return slot == 0 ? n : eytzToSorted[slot];
+    }
+
+    static size_t countTrailingOnes(size_t x) {
+        size_t count = 0;
+        while (x & 1) {
+            x >>= 1;
+            count++;
+        }
+        return count;
+    }
+
+    void dropEytzinger() {
+        eytzinger.clear();
+        eytzToSorted.clear();
+        eytzingerEnabled = false;
+    }
+};
+
+#endif // SORTED_KEY_VALUE_H
@@ -0,0 +1,780 @@
+#ifndef UNROLLED_LINKED_LIST_H
+#define UNROLLED_LINKED_LIST_H
+
+#include <new>
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <type_traits>
+#include <iostream>
+#include <stdexcept>
+#include <initializer_list>
+
+/**
+ * Unrolled Linked List Implementation in C++
+ *
+ * Time Complexity (K = elements per node):
+ * - Insert at head / tail: O(1) amortized, O(K) worst case
+ * - Insert at index: O(n / K + K)
+ * - Insert / erase after iterator: O(K)
+ * - Delete at head / tail: O(1) amortized, O(K) worst case
+ * - Delete at index: O(n / K + K)
+ * - Search: O(n), but scans K contiguous elements per cache miss
+ * - Access by index: O(n / K)
+ *
+ * Space Complexity: O(n), roughly one node header per K elements
+ *
+ * Each node holds up to K elements in an inline array, so a sequential
+ * scan touches one or two cache lines per K elements instead of one per
+ * element. A full node is split in half before an insert, and a node that
+ * drops below half full after a removal absorbs its successor when the two
+ * fit together. Elements sit in a window of the node's array with free
+ * slots at both ends, and inserts and removals shift the shorter side, so
+ * the list works as a deque at both ends without moving whole nodes. The
+ * default K fills about two cache lines.
+ */
+
+/**
+ * Default elements per node: about two 64-byte cache lines per node
+ */
+template <typename T>
+constexpr size_t unrolledNodeCapacity() {
+    constexpr size_t header = 4 * sizeof(void*);
+    constexpr size_t fit = sizeof(T) < 128 - header ? (128 - header) / sizeof(T) : 1;
+    return fit < 4 ? 4 : fit;
+}
+
+template <typename T, size_t K = unrolledNodeCapacity<T>()>
+class UnrolledLinkedList {
+    static_assert(K >= 2, "Nodes must hold at least two elements");
+
+private:
+    /**
+     * Node holding up to K elements in raw storage
+     * Elements occupy slots [begin, begin + count), leaving free slots at
+     * either end so both ends can grow without shifting
+     */
+    struct Node {
+        Node* prev;
+        Node* next;
+        size_t begin;   // Slot of the first element
+        size_t count;
+        alignas(T) unsigned char storage[K * sizeof(T)];
+
+        Node() : prev(nullptr), next(nullptr), begin(0), count(0) {}
+
+        T* items() {
+            return std::launder(reinterpret_cast<T*>(storage)) + begin;
+        }
+
+        const T* items() const {
+            return std::launder(reinterpret_cast<const T*>(storage)) + begin;
+        }
+
+        /**
+         * Raw slot i of the storage (for constructing elements)
+         */
+        void* slot(size_t i) {
+            return storage + i * sizeof(T);
+        }
+
+        bool hasFrontRoom() const {
+            return begin > 0;
+        }
+
+        bool hasBackRoom() const {
+            return begin + count < K;
+        }
+
+        /**
+         * Open a gap at pos and move value there (count < K), shifting
+         * whichever side is shorter and has room; O(1) at either end when
+         * that end has a free slot
+         * value must not live in this node: shifting would move it first
+         */
+        void insertAt(size_t pos, T&& value) {
+            T* a = items();
+            if (hasFrontRoom() && (pos < count / 2 || !hasBackRoom())) {
+                // Shift [0, pos) one slot towards the front
+                if (pos == 0) {
+                    new (slot(begin - 1)) T(std::move(value));
+                } else {
+                    new (slot(begin - 1)) T(std::move(a[0]));
+                    for (size_t i = 0; i + 1 < pos; ++i) {
+                        a[i] = std::move(a[i + 1]);
+                    }
+                    a[pos - 1] = std::move(value);
+                }
+                begin--;
+            } else if (pos == count) {
+                new (slot(begin + count)) T(std::move(value));
+            } else {
+                // Shift [pos, count) one slot towards the back
+                new (slot(begin + count)) T(std::move(a[count - 1]));
+                for (size_t i = count - 1; i > pos; --i) {
+                    a[i] = std::move(a[i - 1]);
+                }
+                a[pos] = std::move(value);
+            }
+            count++;
+        }
+
+        /**
+         * Remove the element at pos and close the gap from the shorter side
+         */
+        T removeAt(size_t pos) {
+            T* a = items();
+            T value = std::move(a[pos]);
+            if (pos < count / 2) {
+                for (size_t i = pos; i > 0; --i) {
+                    a[i] = std::move(a[i - 1]);
+                }
+                a[0].~T();
+                begin++;
+            } else {
+                for (size_t i = pos; i + 1 < count; ++i) {
+                    a[i] = std::move(a[i + 1]);
+                }
+                a[count - 1].~T();
+            }
+            count--;
+            if (count == 0) {
+                begin = 0;
+            }
+            return value;
+        }
+
+        /**
+         * Move every element so the first one sits in slot target
+         * (target + count <= K)
+         */
+        void relocate(size_t target) {
+            T* a = items();
+            if (target < begin) {
+                // Moving down: every destination is free or already vacated
+                for (size_t i = 0; i < count; ++i) {
+                    new (slot(target + i)) T(std::move(a[i]));
+                    a[i].~T();
+                }
+            } else if (target > begin) {
+                for (size_t i = count; i > 0; --i) {
+                    new (slot(target + i - 1)) T(std::move(a[i - 1]));
+                    a[i - 1].~T();
+                }
+            }
+            begin = target;
+        }
+
+        /**
+         * Move elements [from, count) to the end of other
+         */
+        void moveTailTo(size_t from, Node* other) {
+            if (other->begin + other->count + (count - from) > K) {
+                other->relocate(0);
+            }
+            T* a = items();
+            for (size_t i = from; i < count; ++i) {
+                new (other->slot(other->begin + other->count++)) T(std::move(a[i]));
+                a[i].~T();
+            }
+            count = from;
+        }
+
+        void destroyAll() {
+            T* a = items();
+            for (size_t i = 0; i < count; ++i) {
+                a[i].~T();
+            }
+            begin = 0;
+            count = 0;
+        }
+    };
+
+    Node* head;     // Pointer to first node
+    Node* tail;     // Pointer to last node
+    size_t size;    // Current number of elements
+
+public:
+    /**
+     * Forward iterator over list elements
+     */
+    template <bool IsConst>
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+
+        Iterator() : node(nullptr), offset(0) {}
+
+        template <bool WasConst, typename = std::enable_if_t<IsConst && !WasConst>>
+        Iterator(const Iterator<WasConst>& other) : node(other.node), offset(other.offset) {}
+
+        reference operator*() const {
+            return node->items()[offset];
+        }
+
+        pointer operator->() const {
+            return node->items() + offset;
+        }
+
+        Iterator& operator++() {
+            if (++offset == node->count) {
+                node = node->next;
+                offset = 0;
+            }
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        friend bool operator==(const Iterator& a, const Iterator& b) {
+            return a.node == b.node && a.offset == b.offset;
+        }
+
+        friend bool operator!=(const Iterator& a, const Iterator& b) {
+            return !(a == b);
+        }
+
+    private:
+        friend class UnrolledLinkedList;
+
+        Node* node;
+        size_t offset;
+
+        Iterator(Node* n, size_t off) : node(n), offset(off) {}
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    /**
+     * Constructor - Initialize empty list
+     */
+    UnrolledLinkedList() : head(nullptr), tail(nullptr), size(0) {}
+
+    /**
+     * Constructor with initializer list
+     */
+    UnrolledLinkedList(std::initializer_list<T> init) : head(nullptr), tail(nullptr), size(0) {
+        for (const auto& item : init) {
+            pushBack(item);
+        }
+    }
+
+    /**
+     * Copy constructor
+     */
+    UnrolledLinkedList(const UnrolledLinkedList& other) : head(nullptr), tail(nullptr), size(0) {
+        copyFrom(other);
+    }
+
+    /**
+     * Assignment operator
+     */
+    UnrolledLinkedList& operator=(const UnrolledLinkedList& other) {
+        if (this != &other) {
+            clear();
+            copyFrom(other);
+        }
+        return *this;
+    }
+
+    /**
+     * Destructor - Clean up all nodes
+     */
+    ~UnrolledLinkedList() {
+        clear();
+    }
+
+    /**
+     * Add element to the front of the list
+     */
+    void pushFront(const T& value) {
+        T item(value);  // Copy first: value may refer into the list
+        if (head == nullptr) {
+            linkBefore(head, makeNode(std::move(item), K / 2));
+        } else if (head->hasFrontRoom()) {
+            head->insertAt(0, std::move(item));
+        } else if (head->count <= K / 2) {
+            // Centre the elements once; at least K / 4 front pushes follow for free
+            head->relocate((K - head->count + 1) / 2);
+            head->insertAt(0, std::move(item));
+        } else {
+            linkBefore(head, makeNode(std::move(item), K - 1));
+        }
+        size++;
+    }
+
+    /**
+     * Add element to the back of the list
+     */
+    void pushBack(const T& value) {
+        T item(value);
+        if (tail == nullptr) {
+            linkAfter(tail, makeNode(std::move(item), K / 2));
+        } else if (tail->hasBackRoom()) {
+            tail->insertAt(tail->count, std::move(item));
+        } else if (tail->count <= K / 2) {
+            tail->relocate((K - tail->count) / 2);
+            tail->insertAt(tail->count, std::move(item));
+        } else {
+            linkAfter(tail, makeNode(std::move(item), 0));
+        }
+        size++;
+    }
+
+    /**
+     * Insert element at specific index
+     * @throws std::out_of_range if index is invalid
+     */
+    void insert(size_t index, const T& value) {
+        if (index > size) {
+            throw std::out_of_range("Index out of range");
+        }
+
+        if (index == size) {
+            pushBack(value);
+            return;
+        }
+
+        T item(value);
+        auto [node, offset] = locate(index);
+        insertInto(node, offset, std::move(item));
+    }
+
+    /**
+     * Insert element right after the element at pos
+     * @param pos Iterator to an element of this list
+     * @param value Element to insert
+     * @return Iterator to the inserted element
+     * @throws std::out_of_range if pos is end()
+     */
+    iterator insertAfter(const_iterator pos, const T& value) {
+        if (pos.node == nullptr) {
+            throw std::out_of_range("Iterator out of range");
+        }
+        T item(value);
+        return insertInto(pos.node, pos.offset + 1, std::move(item));
+    }
+
+    /**
+     * Remove the element right after the element at pos
+     * @param pos Iterator to an element of this list
+     * @return Iterator to the element following the removed one
+     * @throws std::out_of_range if pos is end() or the last element
+     */
+    iterator eraseAfter(const_iterator pos) {
+        if (pos.node == nullptr) {
+            throw std::out_of_range("Iterator out of range");
+        }
+        const_iterator victim = pos;
+        ++victim;
+        if (victim.node == nullptr) {
+            throw std::out_of_range("Iterator out of range");
+        }
+
+        Node* node = victim.node;
+        size_t offset = victim.offset;
+        Node* next = node->next;
+        bool emptiesNode = node->count == 1;
+        removeFrom(node, offset);
+
+        if (emptiesNode) {
+            return iterator(next, 0);
+        }
+        // node survives (a merge only ever deletes its successor)
+        return offset < node->count ? iterator(node, offset) : iterator(node->next, 0);
+    }
+
+    /**
+     * Remove element from the front of the list
+     * @throws std::underflow_error if list is empty
+     */
+    T popFront() {
+        if (isEmpty()) {
+            throw std::underflow_error("List is empty");
+        }
+        return removeFrom(head, 0);
+    }
+
+    /**
+     * Remove element from the back of the list
+     * @throws std::underflow_error if list is empty
+     */
+    T popBack() {
+        if (isEmpty()) {
+            throw std::underflow_error("List is empty");
+        }
+        return removeFrom(tail, tail->count - 1);
+    }
+
+    /**
+     * Remove element at specific index
+     * @throws std::out_of_range if index is invalid
+     */
+    T removeAt(size_t index) {
+        if (index >= size) {
+            throw std::out_of_range("Index out of range");
+        }
+        auto [node, offset] = locate(index);
+        return removeFrom(node, offset);
+    }
+
+    /**
+     * Remove first occurrence of value
+     * @return true if element was found and removed, false otherwise
+     */
+    bool remove(const T& value) {
+        for (Node* node = head; node != nullptr; node = node->next) {
+            const T* a = node->items();
+            for (size_t i = 0; i < node->count; ++i) {
+                if (a[i] == value) {
+                    removeFrom(node, i);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Get element at specific index
+     * @throws std::out_of_range if index is invalid
+     */
+    T& at(size_t index) {
+        if (index >= size) {
+            throw std::out_of_range("Index out of range");
+        }
+        auto [node, offset] = locate(index);
+        return node->items()[offset];
+    }
+
+    /**
+     * Get element at specific index (const version)
+     */
+    const T& at(size_t index) const {
+        if (index >= size) {
+            throw std::out_of_range("Index out of range");
+        }
+        auto [node, offset] = locate(index);
+        return node->items()[offset];
+    }
+
+    /**
+     * Get first element
+     * @throws std::underflow_error if list is empty
+     */
+    T& front() {
+        if (isEmpty()) {
+            throw std::underflow_error("List is empty");
+        }
+        return head->items()[0];
+    }
+
+    const T& front() const {
+        if (isEmpty()) {
+            throw std::underflow_error("List is empty");
+        }
+        return head->items()[0];
+    }
+
+    /**
+     * Get last element
+     * @throws std::underflow_error if list is empty
+     */
+    T& back() {
+        if (isEmpty()) {
+            throw std::underflow_error("List is empty");
+        }
+        return tail->items()[tail->count - 1];
+    }
+
+    const T& back() const {
+        if (isEmpty()) {
+            throw std::underflow_error("List is empty");
+        }
+        return tail->items()[tail->count - 1];
+    }
+
+    /**
+     * Find index of first occurrence of value
+     * @return Index of value, or -1 if not found
+     */
+    int find(const T& value) const {
+        int base = 0;
+        for (Node* node = head; node != nullptr; node = node->next) {
+            const T* a = node->items();
+            for (size_t i = 0; i < node->count; ++i) {
+                if (a[i] == value) {
+                    return base + static_cast<int>(i);
+                }
+            }
+            base += static_cast<int>(node->count);
+        }
+        return -1;
+    }
+
+    /**
+     * Check if value exists in the list
+     */
+    bool contains(const T& value) const {
+        return find(value) != -1;
+    }
+
+    /**
+     * Check if list is empty
+     */
+    bool isEmpty() const {
+        return size == 0;
+    }
+
+    /**
+     * Get current size of list
+     */
+    size_t getSize() const {
+        return size;
+    }
+
+    /**
+     * Get number of nodes (for inspecting fill factor)
+     */
+    size_t getNodeCount() const {
+        size_t count = 0;
+        for (Node* node = head; node != nullptr; node = node->next) {
+            count++;
+        }
+        return count;
+    }
+
+    /**
+     * Get maximum elements per node
+     */
+    static constexpr size_t nodeCapacity() {
+        return K;
+    }
+
+    /**
+     * Clear all elements from list
+     */
+    void clear() {
+        Node* node = head;
+        while (node != nullptr) {
+            Node* next = node->next;
+            node->destroyAll();
+            delete node;
+            node = next;
+        }
+        head = tail = nullptr;
+        size = 0;
+    }
+
+    /**
+     * Reverse the list (node order and order inside every node)
+     */
+    void reverse() {
+        Node* node = head;
+        while (node != nullptr) {
+            Node* next = node->next;
+            std::swap(node->prev, node->next);
+            T* a = node->items();
+            for (size_t i = 0, j = node->count; i + 1 < j; ++i, --j) {
+                std::swap(a[i], a[j - 1]);
+            }
+            node = next;
+        }
+        std::swap(head, tail);
+    }
+
+    /**
+     * Display list contents (for debugging)
+     */
+    void display() const {
+        if (isEmpty()) {
+            std::cout << "List is empty" << std::endl;
+            return;
+        }
+
+        std::cout << "List: ";
+        bool first = true;
+        for (const T& value : *this) {
+            if (!first) std::cout << " -> ";
+            std::cout << value;
+            first = false;
+        }
+        std::cout << " (size: " << size << ", nodes: " << getNodeCount() << ")" << std::endl;
+    }
+
+    T& operator[](size_t index) {
+        return at(index);
+    }
+
+    const T& operator[](size_t index) const {
+        return at(index);
+    }
+
+    iterator begin() {
+        return iterator(head, 0);
+    }
+
+    iterator end() {
+        return iterator(nullptr, 0);
+    }
+
+    const_iterator begin() const {
+        return const_iterator(head, 0);
+    }
+
+    const_iterator end() const {
+        return const_iterator(nullptr, 0);
+    }
+
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    const_iterator cend() const {
+        return end();
+    }
+
+private:
+    /**
+     * Allocate an unlinked node holding value in slot at (freed again if the
+     * move throws); new end nodes start at the far side so they fill inwards
+     */
+    static Node* makeNode(T&& value, size_t at) {
+        Node* node = new Node();
+        try {
+            new (node->slot(at)) T(std::move(value));
+            node->begin = at;
+            node->count = 1;
+        } catch (...) {
+            delete node;
+            throw;
+        }
+        return node;
+    }
+
+    /**
+     * Insert value at offset of node (offset <= count), splitting a full node
+     * @return Iterator to the inserted element
+     */
+    iterator insertInto(Node* node, size_t offset, T&& value) {
+        if (node->count == K) {
+            // Split the full node in half, then insert into the correct half
+            Node* right = new Node();
+            linkAfter(node, right);
+            node->moveTailTo(K / 2, right);
+            if (offset > node->count) {
+                offset -= node->count;
+                node = right;
+            }
+        }
+        node->insertAt(offset, std::move(value));
+        size++;
+        return iterator(node, offset);
+    }
+
+    /**
+     * Find node and offset holding index (walks from the nearer end)
+     */
+    std::pair<Node*, size_t> locate(size_t index) const {
+        if (index < size / 2) {
+            Node* node = head;
+            while (index >= node->count) {
+                index -= node->count;
+                node = node->next;
+            }
+            return {node, index};
+        }
+
+        size_t fromBack = size - 1 - index;
+        Node* node = tail;
+        while (fromBack >= node->count) {
+            fromBack -= node->count;
+            node = node->prev;
+        }
+        return {node, node->count - 1 - fromBack};
+    }
+
+    /**
+     * Remove element at offset of node, then merge or unlink as needed
+     */
+    T removeFrom(Node* node, size_t offset) {
+        T value = node->removeAt(offset);
+        size--;
+
+        if (node->count == 0) {
+            unlink(node);
+            delete node;
+        } else if (node->count < K / 2 && node->next != nullptr &&
+                   node->count + node->next->count <= K) {
+            // Keep nodes at least half full so scans stay dense
+            Node* next = node->next;
+            next->moveTailTo(0, node);
+            unlink(next);
+            delete next;
+        }
+        return value;
+    }
+
+    void linkAfter(Node* pos, Node* node) {
+        node->prev = pos;
+        node->next = pos != nullptr ? pos->next : nullptr;
+        if (node->next != nullptr) {
+            node->next->prev = node;
+        } else {
+            tail = node;
+        }
+        if (pos != nullptr) {
+            pos->next = node;
+        } else {
+            head = node;
+        }
+    }
+
+    void linkBefore(Node* pos, Node* node) {
+        if (pos == nullptr) {
+            linkAfter(tail, node);
+            return;
+        }
+        node->next = pos;
+        node->prev = pos->prev;
+        if (pos->prev != nullptr) {
+            pos->prev->next = node;
+        } else {
+            head = node;
+        }
+        pos->prev = node;
+    }
+
+    void unlink(Node* node) {
+        if (node->prev != nullptr) {
+            node->prev->next = node->next;
+        } else {
+            head = node->next;
+        }
+        if (node->next != nullptr) {
+            node->next->prev = node->prev;
+        } else {
+            tail = node->prev;
+        }
+    }
+
+    /**
+     * Helper function to copy from another list
+     */
+    void copyFrom(const UnrolledLinkedList& other) {
+        for (const T& value : other) {
+            pushBack(value);
+        }
+    }
+};
+
+#endif // UNROLLED_LINKED_LIST_H